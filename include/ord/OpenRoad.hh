@@ -234,8 +234,8 @@ class OpenRoad
   // to notify the tools (eg dbSta, gui).
   void designCreated();
 
-  void readDb(const char* filename);
-  void writeDb(const char* filename);
+  void readDb(const char* filename, bool lazy = false);
+  void writeDb(const char* filename, bool compress = false);
 
   void diffDbs(const char* filename1, const char* filename2, const char* diffs);
 
@@ -37,6 +37,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 #include <thread>
 
 #include "ord/Version.hh"
@@ -444,22 +445,28 @@ void OpenRoad::writeCdl(const char* outFilename,
   }
 }
 
-void OpenRoad::readDb(const char* filename)
+void OpenRoad::readDb(const char* filename, bool lazy)
 {
   if (db_->getChip() && db_->getChip()->getBlock()) {
     logger_->error(
         ORD, 47, "You can't load a new db file as the db is already populated");
   }
 
-  std::ifstream stream;
-  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
-                    | std::ios::eofbit);
-  stream.open(filename, std::ios::binary);
-
   try {
-    db_->read(stream);
+    if (lazy) {
+      db_->readMapped(filename, threads_);
+    } else {
+      std::ifstream stream;
+      stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                        | std::ios::eofbit);
+      stream.open(filename, std::ios::binary);
+      db_->read(stream, threads_);
+    }
   } catch (const std::ios_base::failure& f) {
     logger_->error(ORD, 54, "odb file {} is invalid: {}", filename, f.what());
+  } catch (const std::runtime_error& e) {
+    // odb reports mapping and format errors with ZException.
+    logger_->error(ORD, 54, "odb file {} is invalid: {}", filename, e.what());
   }
 
   for (OpenRoadObserver* observer : observers_) {
@@ -467,14 +474,18 @@ void OpenRoad::readDb(const char* filename)
   }
 }
 
-void OpenRoad::writeDb(const char* filename)
+void OpenRoad::writeDb(const char* filename, bool compress)
 {
+  // The file may be the one a lazy read_db mapped; read everything before it
+  // is truncated.
+  db_->loadSections();
+
   std::ofstream stream;
   stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
                     | std::ios::eofbit);
   stream.open(filename, std::ios::binary);
 
-  db_->write(stream);
+  db_->write(stream, threads_, compress);
 }
 
 void OpenRoad::diffDbs(const char* filename1,
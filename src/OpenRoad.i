@@ -397,17 +397,19 @@ write_cdl_cmd(const char *outFilename,
 }
 
 void
-read_db_cmd(const char *filename)
+read_db_cmd(const char *filename,
+            bool lazy)
 {
   OpenRoad *ord = getOpenRoad();
-  ord->readDb(filename);
+  ord->readDb(filename, lazy);
 }
 
 void
-write_db_cmd(const char *filename)
+write_db_cmd(const char *filename,
+             bool compress)
 {
   OpenRoad *ord = getOpenRoad();
-  ord->writeDb(filename);
+  ord->writeDb(filename, compress);
 }
 
 void
@@ -36,6 +36,7 @@
 #pragma once
 
 #include <set>
+#include <string>
 
 #include "odb/db.h"
 #include "sta/ConcreteNetwork.hh"
@@ -103,6 +104,19 @@ class dbNetwork : public ConcreteNetwork
   void makeLibrary(dbLib* lib);
   void makeCell(Library* library, dbMaster* master);
 
+  // Literal text of a glob pattern before its first wildcard or escape.
+  // Returns false for patterns without such a prefix (regexp, nocase).
+  static bool patternPrefix(const PatternMatch* pattern,
+                            // Return value.
+                            std::string& prefix);
+  // Top level instances/nets whose names start with prefix, in id order.
+  void findTopInstsByPrefix(const char* prefix,
+                            // Return value.
+                            InstanceSeq& insts) const;
+  void findTopNetsByPrefix(const char* prefix,
+                           // Return value.
+                           NetSeq& nets) const;
+
   void location(const Pin* pin,
                 // Return values.
                 double& x,
@@ -174,6 +188,10 @@ class dbNetwork : public ConcreteNetwork
   bool isLeaf(const Instance* instance) const override;
   Instance* findInstance(const char* path_name) const override;
   Instance* findChild(const Instance* parent, const char* name) const override;
+  void findChildrenMatching(const Instance* parent,
+                            const PatternMatch* pattern,
+                            // Return value.
+                            InstanceSeq& matches) const override;
   InstanceChildIterator* childIterator(const Instance* instance) const override;
   InstancePinIterator* pinIterator(const Instance* instance) const override;
   InstanceNetIterator* netIterator(const Instance* instance) const override;
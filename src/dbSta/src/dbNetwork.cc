@@ -37,6 +37,11 @@
 
 #include "db_sta/dbNetwork.hh"
 
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
 #include "odb/db.h"
 #include "sta/Liberty.hh"
 #include "sta/PatternMatch.hh"
@@ -538,23 +543,89 @@ Net* dbNetwork::findNet(const Instance* instance, const char* net_name) const
   return dbToSta(dnet);
 }
 
+bool dbNetwork::patternPrefix(const PatternMatch* pattern, std::string& prefix)
+{
+  if (pattern->isRegexp() || pattern->nocase()) {
+    return false;
+  }
+  const char* pat = pattern->pattern();
+  prefix.assign(pat, strcspn(pat, "*?[\\"));
+  return true;
+}
+
+void dbNetwork::findTopInstsByPrefix(const char* prefix,
+                                     InstanceSeq& insts) const
+{
+  // Candidates come back in name order; keep the order of a full scan.
+  std::vector<dbInst*> db_insts;
+  block_->findInstsByPrefix(prefix, db_insts);
+  std::sort(db_insts.begin(),
+            db_insts.end(),
+            [](dbInst* inst1, dbInst* inst2) {
+              return inst1->getId() < inst2->getId();
+            });
+  for (dbInst* inst : db_insts) {
+    insts.push_back(dbToSta(inst));
+  }
+}
+
+void dbNetwork::findTopNetsByPrefix(const char* prefix, NetSeq& nets) const
+{
+  std::vector<dbNet*> dnets;
+  block_->findNetsByPrefix(prefix, dnets);
+  std::sort(dnets.begin(), dnets.end(), [](dbNet* net1, dbNet* net2) {
+    return net1->getId() < net2->getId();
+  });
+  for (dbNet* dnet : dnets) {
+    nets.push_back(dbToSta(dnet));
+  }
+}
+
+void dbNetwork::findChildrenMatching(const Instance* parent,
+                                     const PatternMatch* pattern,
+                                     InstanceSeq& matches) const
+{
+  std::string prefix;
+  if (parent != top_instance_ || !pattern->hasWildcards()
+      || !patternPrefix(pattern, prefix)) {
+    Network::findChildrenMatching(parent, pattern, matches);
+    return;
+  }
+  InstanceSeq insts;
+  findTopInstsByPrefix(prefix.c_str(), insts);
+  for (Instance* inst : insts) {
+    if (pattern->match(staToDb(inst)->getConstName())) {
+      matches.push_back(inst);
+    }
+  }
+}
+
 void dbNetwork::findInstNetsMatching(const Instance* instance,
                                      const PatternMatch* pattern,
                                      NetSeq& nets) const
 {
   if (instance == top_instance_) {
-    if (pattern->hasWildcards()) {
+    std::string prefix;
+    if (!pattern->hasWildcards()) {
+      dbNet* dnet = block_->findNet(pattern->pattern());
+      if (dnet) {
+        nets.push_back(dbToSta(dnet));
+      }
+    } else if (patternPrefix(pattern, prefix)) {
+      NetSeq candidates;
+      findTopNetsByPrefix(prefix.c_str(), candidates);
+      for (Net* net : candidates) {
+        if (pattern->match(staToDb(net)->getConstName())) {
+          nets.push_back(net);
+        }
+      }
+    } else {
       for (dbNet* dnet : block_->getNets()) {
         const char* net_name = dnet->getConstName();
         if (pattern->match(net_name)) {
           nets.push_back(dbToSta(dnet));
         }
       }
-    } else {
-      dbNet* dnet = block_->findNet(pattern->pattern());
-      if (dnet) {
-        nets.push_back(dbToSta(dnet));
-      }
     }
   }
 }
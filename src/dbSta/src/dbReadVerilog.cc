@@ -37,6 +37,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include "db_sta/dbNetwork.hh"
 #include "db_sta/dbSta.hh"
@@ -171,6 +172,7 @@ class Verilog2db
       std::vector<std::pair<const Instance*, dbModule*>>& inst_module_vec);
   bool hasTerminals(Net* net) const;
   dbMaster* getMaster(Cell* cell);
+  dbMTerm* findMTerm(dbMaster* master, const Pin* pin);
   dbModule* makeUniqueDbModule(const char* name);
 
   Network* network_;
@@ -178,6 +180,10 @@ class Verilog2db
   dbBlock* block_ = nullptr;
   Logger* logger_;
   std::map<Cell*, dbMaster*> master_map_;
+  // Leaf instances and the master terms of their ports, so that
+  // connecting pins does not look objects up by name.
+  std::unordered_map<const Instance*, dbInst*> inst_map_;
+  std::unordered_map<const Port*, dbMTerm*> mterm_map_;
   std::map<std::string, int> uniquify_id_;  // key: module name
  private:
   bool hierarchy_ = false;
@@ -248,8 +254,15 @@ void Verilog2db::makeDbNetlist()
 {
   std::vector<std::pair<const Instance*, dbModule*>> inst_module_vec;
   recordBusPortsOrder();
+  const int leaf_count = network_->leafInstanceCount();
+  block_->reserveNames(leaf_count, network_->netCount());
+  inst_map_.reserve(leaf_count);
   makeDbModule(network_->topInstance(), /* parent */ nullptr, inst_module_vec);
   makeDbNets(network_->topInstance());
+  // The maps are only needed to connect pins; release them before the
+  // rest of the flow runs.
+  inst_map_ = {};
+  mterm_map_ = {};
   if (hierarchy_) {
     makeVModNets(inst_module_vec);
   }
@@ -398,18 +411,6 @@ void Verilog2db::makeDbModule(
       makeDbModule(child, module, inst_module_vec);
     } else {
       const char* child_name = network_->pathName(child);
-      Instance* parent_instance = network_->parent(child);
-      dbModule* parent_module = nullptr;
-      Cell* parent_cell = nullptr;
-      if (parent_instance == network_->topInstance()) {
-        parent_module = block_->getTopModule();
-        parent_cell = network_->cell(parent_instance);
-      } else {
-        parent_cell = network_->cell(parent_instance);
-        parent_module = block_->findModule(network_->name(parent_cell));
-      }
-      (void) parent_module;
-      (void) parent_cell;
       Cell* cell = network_->cell(child);
       dbMaster* master = getMaster(cell);
       if (master == nullptr) {
@@ -432,6 +433,7 @@ void Verilog2db::makeDbModule(
                       module->getName());
         continue;
       }
+      inst_map_[child] = db_inst;
       module->addInst(db_inst);
     }
   }
@@ -538,8 +540,8 @@ void Verilog2db::makeDbNets(const Instance* inst)
   NetIterator* net_iter = network_->netIterator(inst);
   while (net_iter->hasNext()) {
     Net* net = net_iter->next();
-    const char* net_name = network_->pathName(net);
     if (is_top || !hasTerminals(net)) {
+      const char* net_name = network_->pathName(net);
       dbNet* db_net = dbNet::create(block_, net_name);
 
       if (network_->isPower(net)) {
@@ -568,13 +570,10 @@ void Verilog2db::makeDbNets(const Instance* inst)
             bterm->setIoType(io_type);
           }
         } else if (network_->isLeaf(pin)) {
-          const char* port_name = network_->portName(pin);
-          Instance* inst = network_->instance(pin);
-          const char* inst_name = network_->pathName(inst);
-          dbInst* db_inst = block_->findInst(inst_name);
-          if (db_inst) {
-            dbMaster* master = db_inst->getMaster();
-            dbMTerm* mterm = master->findMTerm(block_, port_name);
+          auto inst_iter = inst_map_.find(network_->instance(pin));
+          if (inst_iter != inst_map_.end()) {
+            dbInst* db_inst = inst_iter->second;
+            dbMTerm* mterm = findMTerm(db_inst->getMaster(), pin);
             if (mterm) {
               db_inst->getITerm(mterm)->connect(db_net);
             }
@@ -754,4 +753,18 @@ dbMaster* Verilog2db::getMaster(Cell* cell)
   return nullptr;
 }
 
+// The port of a leaf pin belongs to the cell of its instance, which
+// has a single master, so the port identifies the master term.
+dbMTerm* Verilog2db::findMTerm(dbMaster* master, const Pin* pin)
+{
+  const Port* port = network_->port(pin);
+  auto miter = mterm_map_.find(port);
+  if (miter != mterm_map_.end()) {
+    return miter->second;
+  }
+  dbMTerm* mterm = master->findMTerm(block_, network_->name(port));
+  mterm_map_[port] = mterm;
+  return mterm;
+}
+
 }  // namespace ord
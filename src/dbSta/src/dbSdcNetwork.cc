@@ -35,6 +35,9 @@
 
 #include "dbSdcNetwork.hh"
 
+#include <string>
+
+#include "db_sta/dbNetwork.hh"
 #include "sta/ParseBus.hh"
 #include "sta/PatternMatch.hh"
 
@@ -47,6 +50,22 @@ dbSdcNetwork::dbSdcNetwork(Network* network) : SdcNetwork(network)
 {
 }
 
+// SDC names drop the escape before path dividers, so the literal prefix
+// of an SDC pattern only matches db names up to its first divider.
+bool dbSdcNetwork::sdcPatternPrefix(const PatternMatch* pattern,
+                                    std::string& prefix) const
+{
+  if (!dynamic_cast<const dbNetwork*>(network_)
+      || !dbNetwork::patternPrefix(pattern, prefix)) {
+    return false;
+  }
+  const size_t divider = prefix.find(divider_);
+  if (divider != std::string::npos) {
+    prefix.erase(divider);
+  }
+  return true;
+}
+
 // Override SdcNetwork to NetworkNameAdapter.
 Instance* dbSdcNetwork::findInstance(const char* path_name) const
 {
@@ -91,6 +110,18 @@ InstanceSeq dbSdcNetwork::findInstancesMatching(
 void dbSdcNetwork::findInstancesMatching1(const PatternMatch* pattern,
                                           InstanceSeq& insts) const
 {
+  std::string prefix;
+  if (sdcPatternPrefix(pattern, prefix)) {
+    InstanceSeq candidates;
+    static_cast<const dbNetwork*>(network_)->findTopInstsByPrefix(
+        prefix.c_str(), candidates);
+    for (Instance* child : candidates) {
+      if (pattern->match(staToSdc(name(child)))) {
+        insts.push_back(child);
+      }
+    }
+    return;
+  }
   InstanceChildIterator* child_iter = childIterator(topInstance());
   while (child_iter->hasNext()) {
     Instance* child = child_iter->next();
@@ -129,6 +160,23 @@ NetSeq dbSdcNetwork::findNetsMatching(const Instance*,
 void dbSdcNetwork::findNetsMatching1(const PatternMatch* pattern,
                                      NetSeq& nets) const
 {
+  std::string prefix;
+  if (sdcPatternPrefix(pattern, prefix)) {
+    const dbNetwork* db_network = static_cast<const dbNetwork*>(network_);
+    NetSeq candidates;
+    db_network->findTopNetsByPrefix(prefix.c_str(), candidates);
+    for (Net* net : candidates) {
+      // Skip the special supply nets netIterator skips.
+      dbNet* dnet = db_network->staToDb(net);
+      if (dnet->getSigType().isSupply() && dnet->isSpecial()) {
+        continue;
+      }
+      if (pattern->match(staToSdc(name(net)))) {
+        nets.push_back(net);
+      }
+    }
+    return;
+  }
   NetIterator* net_iter = netIterator(topInstance());
   while (net_iter->hasNext()) {
     Net* net = net_iter->next();
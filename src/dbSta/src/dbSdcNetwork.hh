@@ -35,6 +35,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "sta/SdcNetwork.hh"
 
 namespace sta {
@@ -52,6 +54,9 @@ class dbSdcNetwork : public SdcNetwork
                           const PatternMatch* pattern) const override;
 
  protected:
+  bool sdcPatternPrefix(const PatternMatch* pattern,
+                        // Return value.
+                        std::string& prefix) const;
   void findInstancesMatching1(const PatternMatch* pattern,
                               InstanceSeq& insts) const;
   void findNetsMatching1(const PatternMatch* pattern, NetSeq& nets) const;
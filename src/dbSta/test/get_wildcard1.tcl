@@ -0,0 +1,72 @@
+# wildcard get_cells/get_nets/get_pins answered from the name index
+source "helpers.tcl"
+read_lef example1.lef
+read_def example1.def
+read_liberty example1_slow.lib
+
+set block [ord::get_db_block]
+
+proc full_names { objects } {
+  set names {}
+  foreach object $objects {
+    lappend names [get_full_name $object]
+  }
+  return $names
+}
+
+# Names a full scan of the block matches, in id order.
+proc scan_insts { pattern } {
+  set names {}
+  foreach inst [$::block getInsts] {
+    if { [string match $pattern [$inst getName]] } {
+      lappend names [$inst getName]
+    }
+  }
+  return $names
+}
+
+proc scan_nets { pattern } {
+  set names {}
+  foreach net [$::block getNets] {
+    if { [$net getSigType] in {POWER GROUND} && [$net isSpecial] } {
+      continue
+    }
+    if { [string match $pattern [$net getName]] } {
+      lappend names [$net getName]
+    }
+  }
+  return $names
+}
+
+foreach pattern {r* u? *1 r?q *z * V* x*} {
+  check "get_cells $pattern" {
+    full_names [get_cells -quiet $pattern]
+  } [scan_insts $pattern]
+  check "get_nets $pattern" {
+    full_names [get_nets -quiet $pattern]
+  } [scan_nets $pattern]
+}
+
+check "get_cells r*" { full_names [get_cells r*] } {r1 r2 r3}
+check "get_nets r?q" { full_names [get_nets r?q] } {r1q r2q}
+check "get_nets V*" { llength [get_nets -quiet V*] } 0
+
+check "get_pins r*/CK" {
+  full_names [get_pins r*/CK]
+} {r1/CK r2/CK r3/CK}
+check "get_pins u*/A*" {
+  lsort [full_names [get_pins u*/A*]]
+} {u1/A u2/A1 u2/A2}
+check "get_pins */Q" {
+  full_names [get_pins */Q]
+} {r1/Q r2/Q r3/Q}
+
+# Renaming has to be seen by the next lookup.
+[$block findInst r2] rename x2
+check "get_cells r* after rename" { full_names [get_cells r*] } {r1 r3}
+check "get_cells x* after rename" { full_names [get_cells x*] } {x2}
+check "get_pins x*/CK after rename" {
+  full_names [get_pins x*/CK]
+} {x2/CK}
+
+exit_summary
@@ -43,3 +43,7 @@ record_tests {
 
   write_sdc1
 }
+
+record_pass_fail_tests {
+  get_wildcard1
+}
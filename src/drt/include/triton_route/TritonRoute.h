@@ -32,11 +32,13 @@
 
 #include <boost/asio/thread_pool.hpp>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "odb/geom.h"
@@ -99,6 +101,9 @@ struct ParamStruct
   int minAccessPoints = -1;
   bool saveGuideUpdates = false;
   std::string repairPDNLayerName;
+  bool dynamicScheduling = false;
+  bool taPanelColoring = false;
+  std::string pinAccessCacheFile;
 };
 
 class TritonRoute
@@ -183,13 +188,22 @@ class TritonRoute
   void reportDRC(const std::string& file_name,
                  const std::list<std::unique_ptr<frMarker>>& markers,
                  odb::Rect drcBox = odb::Rect(0, 0, 0, 0));
-  void checkDRC(const char* filename, int x1, int y1, int x2, int y2);
+  void checkDRC(const char* filename,
+                int x1,
+                int y1,
+                int x2,
+                int y2,
+                bool incremental = false);
   bool initGuide();
   void prep();
   void processBTermsAboveTopLayer(bool has_routing = false);
   odb::dbDatabase* getDb() const { return db_; }
 
  private:
+  // Markers of each checked 7x7 GCell tile, keyed by its first GCell.
+  using TileMarkers
+      = std::map<std::pair<int, int>, std::vector<std::unique_ptr<frMarker>>>;
+
   std::unique_ptr<frDesign> design_;
   std::unique_ptr<frDebugSettings> debug_;
   std::unique_ptr<DesignCallBack> db_callback_;
@@ -209,6 +223,8 @@ class TritonRoute
   int results_sz_{0};
   unsigned int cloud_sz_{0};
   boost::asio::thread_pool dist_pool_{1};
+  // check_drc -incremental session
+  TileMarkers drc_tile_markers_;
 
   void initDesign();
   void gr();
@@ -217,6 +233,13 @@ class TritonRoute
   void applyUpdates(const std::vector<std::vector<drUpdate>>& updates);
   void getDRCMarkers(std::list<std::unique_ptr<frMarker>>& markers,
                      const odb::Rect& requiredDrcBox);
+  // Check the tiles overlapping requiredDrcBox that are not in tileMarkers.
+  void checkDRCTiles(const odb::Rect& requiredDrcBox, TileMarkers& tileMarkers);
+  void collectDRCMarkers(const TileMarkers& tileMarkers,
+                         const odb::Rect& requiredDrcBox,
+                         std::list<std::unique_ptr<frMarker>>& markers);
+  // Drop the tiles that the changes since the last check may affect.
+  void invalidateDRCTiles(const std::vector<odb::Rect>& changedBoxes);
   void stackVias(odb::dbBTerm* bterm,
                  int top_layer_idx,
                  int bterm_bottom_layer_idx,
@@ -39,6 +39,11 @@ static inline int defdist(odb::dbBlock* block, int x)
          / (double) block->getDbUnitsPerMicron();
 }
 
+void DesignCallBack::inDbPreMoveInst(odb::dbInst* db_inst)
+{
+  addChangedInst(db_inst);
+}
+
 void DesignCallBack::inDbPostMoveInst(odb::dbInst* db_inst)
 {
   auto design = router_->getDesign();
@@ -61,10 +66,12 @@ void DesignCallBack::inDbPostMoveInst(odb::dbInst* db_inst)
       design->getRegionQuery()->addBlockObj(inst);
     }
   }
+  addChangedInst(db_inst);
 }
 
 void DesignCallBack::inDbInstDestroy(odb::dbInst* db_inst)
 {
+  setStructuralChange();
   auto design = router_->getDesign();
   if (design != nullptr && design->getTopBlock() != nullptr) {
     auto inst = design->getTopBlock()->getInst(db_inst->getName());
@@ -78,4 +85,222 @@ void DesignCallBack::inDbInstDestroy(odb::dbInst* db_inst)
   }
 }
 
+void DesignCallBack::inDbInstCreate(odb::dbInst*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbInstCreate(odb::dbInst*, odb::dbRegion*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbInstPlacementStatusBefore(
+    odb::dbInst* inst,
+    const odb::dbPlacementStatus&)
+{
+  // drt reads every instance whatever its status; re-check its tiles
+  addChangedInst(inst);
+}
+
+void DesignCallBack::inDbInstSwapMasterAfter(odb::dbInst*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbNetCreate(odb::dbNet*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbNetDestroy(odb::dbNet*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbITermPostConnect(odb::dbITerm*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbITermPostDisconnect(odb::dbITerm*, odb::dbNet*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbBTermPostConnect(odb::dbBTerm*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbBTermPostDisConnect(odb::dbBTerm*, odb::dbNet*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbBPinCreate(odb::dbBPin*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbBPinDestroy(odb::dbBPin*)
+{
+  setStructuralChange();
+}
+
+void DesignCallBack::inDbBlockageCreate(odb::dbBlockage* blockage)
+{
+  // placement blockages aren't read by drt
+  addChangedBox(blockage->getBlock(), blockage->getBBox()->getBox());
+}
+
+void DesignCallBack::inDbObstructionCreate(odb::dbObstruction* obstruction)
+{
+  if (tracking_) {
+    obstruction_changes_ = true;
+  }
+  addChangedBox(obstruction->getBlock(), obstruction->getBBox()->getBox());
+}
+
+void DesignCallBack::inDbObstructionDestroy(odb::dbObstruction* obstruction)
+{
+  if (tracking_) {
+    obstruction_changes_ = true;
+  }
+  addChangedBox(obstruction->getBlock(), obstruction->getBBox()->getBox());
+}
+
+void DesignCallBack::inDbWireCreate(odb::dbWire* wire)
+{
+  addChangedNet(wire->getNet());
+}
+
+void DesignCallBack::inDbWireDestroy(odb::dbWire* wire)
+{
+  addChangedNet(wire->getNet());
+}
+
+void DesignCallBack::inDbWirePostModify(odb::dbWire* wire)
+{
+  addChangedNet(wire->getNet());
+}
+
+void DesignCallBack::inDbWirePostAttach(odb::dbWire* wire)
+{
+  addChangedNet(wire->getNet());
+}
+
+void DesignCallBack::inDbWirePostDetach(odb::dbWire*, odb::dbNet* net)
+{
+  addChangedNet(net);
+}
+
+void DesignCallBack::inDbWirePostAppend(odb::dbWire*, odb::dbWire* dst)
+{
+  addChangedNet(dst->getNet());
+}
+
+void DesignCallBack::inDbWirePostCopy(odb::dbWire*, odb::dbWire* dst)
+{
+  addChangedNet(dst->getNet());
+}
+
+void DesignCallBack::inDbSWireCreate(odb::dbSWire* wire)
+{
+  addChangedNet(wire->getNet());
+}
+
+void DesignCallBack::inDbSWireDestroy(odb::dbSWire* wire)
+{
+  addChangedNet(wire->getNet());
+}
+
+void DesignCallBack::inDbSWireAddSBox(odb::dbSBox* box)
+{
+  addChangedBox(box->getSWire()->getBlock(), box->getBox());
+  addChangedNet(box->getSWire()->getNet());
+}
+
+void DesignCallBack::inDbSWireRemoveSBox(odb::dbSBox* box)
+{
+  addChangedBox(box->getSWire()->getBlock(), box->getBox());
+  addChangedNet(box->getSWire()->getNet());
+}
+
+void DesignCallBack::inDbSWirePreDestroySBoxes(odb::dbSWire* wire)
+{
+  for (auto box : wire->getWires()) {
+    addChangedBox(wire->getBlock(), box->getBox());
+  }
+}
+
+void DesignCallBack::inDbSWirePostDestroySBoxes(odb::dbSWire* wire)
+{
+  addChangedNet(wire->getNet());
+}
+
+void DesignCallBack::inDbFillCreate(odb::dbFill* fill)
+{
+  // fills aren't read by drt
+  odb::Rect box;
+  fill->getRect(box);
+  addChangedBox(router_->getDb()->getChip()->getBlock(), box);
+}
+
+void DesignCallBack::startTracking()
+{
+  tracking_ = true;
+  clearChanges();
+}
+
+void DesignCallBack::stopTracking()
+{
+  tracking_ = false;
+  clearChanges();
+}
+
+void DesignCallBack::clearChanges()
+{
+  structural_changes_ = false;
+  obstruction_changes_ = false;
+  nets_.clear();
+  snets_.clear();
+  boxes_.clear();
+}
+
+void DesignCallBack::addChangedNet(odb::dbNet* net)
+{
+  if (!tracking_ || net == nullptr) {
+    return;
+  }
+  if (net->isSpecial()) {
+    snets_.insert(net);
+  } else {
+    nets_.insert(net);
+  }
+}
+
+void DesignCallBack::addChangedInst(odb::dbInst* db_inst)
+{
+  addChangedBox(db_inst->getBlock(), db_inst->getBBox()->getBox());
+}
+
+void DesignCallBack::addChangedBox(odb::dbBlock* block, const odb::Rect& box)
+{
+  if (!tracking_) {
+    return;
+  }
+  boxes_.emplace_back(defdist(block, box.xMin()),
+                      defdist(block, box.yMin()),
+                      defdist(block, box.xMax()),
+                      defdist(block, box.yMax()));
+}
+
+void DesignCallBack::setStructuralChange()
+{
+  if (tracking_) {
+    structural_changes_ = true;
+  }
+}
+
 }  // namespace drt
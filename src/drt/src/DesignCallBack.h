@@ -26,6 +26,11 @@
  * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 
+#pragma once
+
+#include <set>
+#include <vector>
+
 #include "odb/db.h"
 #include "odb/dbBlockCallBackObj.h"
 namespace drt {
@@ -36,10 +41,70 @@ class DesignCallBack : public odb::dbBlockCallBackObj
 {
  public:
   DesignCallBack(TritonRoute* router) : router_(router) {}
+  void inDbPreMoveInst(odb::dbInst* inst) override;
   void inDbPostMoveInst(odb::dbInst* inst) override;
   void inDbInstDestroy(odb::dbInst* inst) override;
 
+  // Change tracking for incremental check_drc.
+  void inDbInstCreate(odb::dbInst* inst) override;
+  void inDbInstCreate(odb::dbInst* inst, odb::dbRegion* region) override;
+  void inDbInstPlacementStatusBefore(
+      odb::dbInst* inst,
+      const odb::dbPlacementStatus& status) override;
+  void inDbInstSwapMasterAfter(odb::dbInst* inst) override;
+  void inDbNetCreate(odb::dbNet* net) override;
+  void inDbNetDestroy(odb::dbNet* net) override;
+  void inDbITermPostConnect(odb::dbITerm* iterm) override;
+  void inDbITermPostDisconnect(odb::dbITerm* iterm, odb::dbNet* net) override;
+  void inDbBTermPostConnect(odb::dbBTerm* bterm) override;
+  void inDbBTermPostDisConnect(odb::dbBTerm* bterm, odb::dbNet* net) override;
+  void inDbBPinCreate(odb::dbBPin* bpin) override;
+  void inDbBPinDestroy(odb::dbBPin* bpin) override;
+  void inDbBlockageCreate(odb::dbBlockage* blockage) override;
+  void inDbObstructionCreate(odb::dbObstruction* obstruction) override;
+  void inDbObstructionDestroy(odb::dbObstruction* obstruction) override;
+  void inDbWireCreate(odb::dbWire* wire) override;
+  void inDbWireDestroy(odb::dbWire* wire) override;
+  void inDbWirePostModify(odb::dbWire* wire) override;
+  void inDbWirePostAttach(odb::dbWire* wire) override;
+  void inDbWirePostDetach(odb::dbWire* wire, odb::dbNet* net) override;
+  void inDbWirePostAppend(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbWirePostCopy(odb::dbWire* src, odb::dbWire* dst) override;
+  void inDbSWireCreate(odb::dbSWire* wire) override;
+  void inDbSWireDestroy(odb::dbSWire* wire) override;
+  void inDbSWireAddSBox(odb::dbSBox* box) override;
+  void inDbSWireRemoveSBox(odb::dbSBox* box) override;
+  void inDbSWirePreDestroySBoxes(odb::dbSWire* wire) override;
+  void inDbSWirePostDestroySBoxes(odb::dbSWire* wire) override;
+  void inDbFillCreate(odb::dbFill* fill) override;
+
+  // Only record changes between startTracking() and stopTracking().
+  void startTracking();
+  void stopTracking();
+  bool isTracking() const { return tracking_; }
+  // Changes the design can't pick up net by net, e.g. new instances.
+  bool hasStructuralChanges() const { return structural_changes_; }
+  // Nets whose routing changed.
+  const std::set<odb::dbNet*>& getChangedNets() const { return nets_; }
+  // Special nets whose wires changed.
+  const std::set<odb::dbNet*>& getChangedSNets() const { return snets_; }
+  bool hasObstructionChanges() const { return obstruction_changes_; }
+  // Old and new boxes of moved instances and of edited shapes.
+  const std::vector<odb::Rect>& getChangedBoxes() const { return boxes_; }
+  void clearChanges();
+
  private:
+  void addChangedNet(odb::dbNet* net);
+  void addChangedInst(odb::dbInst* inst);
+  void addChangedBox(odb::dbBlock* block, const odb::Rect& box);
+  void setStructuralChange();
+
   TritonRoute* router_;
+  bool tracking_{false};
+  bool structural_changes_{false};
+  bool obstruction_changes_{false};
+  std::set<odb::dbNet*> nets_;
+  std::set<odb::dbNet*> snets_;
+  std::vector<odb::Rect> boxes_;
 };
 }  // namespace drt
@@ -321,6 +321,8 @@ void TritonRoute::resetDb(const char* file_name)
 void TritonRoute::clearDesign()
 {
   design_ = std::make_unique<frDesign>(logger_);
+  db_callback_->stopTracking();
+  drc_tile_markers_.clear();
 }
 
 static void deserializeUpdate(frDesign* design,
@@ -951,6 +953,9 @@ int TritonRoute::main()
     FlexPA pa(getDesign(), logger_, dist_);
     pa.setDistributed(dist_ip_, dist_port_, shared_volume_, cloud_sz_);
     pa.setDebug(debug_.get(), db_);
+    if (!PA_CACHE_FILE.empty()) {
+      pa.setCache(PA_CACHE_FILE, db_->getTech());
+    }
     pa_pool.join();
     pa.main();
     if (distributed_ || debug_->debugDR || debug_->debugDumpDR) {
@@ -1011,6 +1016,9 @@ void TritonRoute::pinAccess(const std::vector<odb::dbInst*>& target_insts)
   FlexPA pa(getDesign(), logger_, dist_);
   pa.setTargetInstances(target_insts);
   pa.setDebug(debug_.get(), db_);
+  if (!PA_CACHE_FILE.empty()) {
+    pa.setCache(PA_CACHE_FILE, db_->getTech());
+  }
   if (distributed_) {
     pa.setDistributed(dist_ip_, dist_port_, shared_volume_, cloud_sz_);
     dist_pool_.join();
@@ -1022,9 +1030,18 @@ void TritonRoute::pinAccess(const std::vector<odb::dbInst*>& target_insts)
 
 void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
                                 const Rect& requiredDrcBox)
+{
+  TileMarkers tileMarkers;
+  checkDRCTiles(requiredDrcBox, tileMarkers);
+  collectDRCMarkers(tileMarkers, requiredDrcBox, markers);
+}
+
+void TritonRoute::checkDRCTiles(const Rect& requiredDrcBox,
+                                TileMarkers& tileMarkers)
 {
   MAX_THREADS = ord::OpenRoad::openRoad()->getThreadCount();
   std::vector<std::vector<std::unique_ptr<FlexGCWorker>>> workersBatches(1);
+  std::vector<std::vector<std::pair<int, int>>> tilesBatches(1);
   auto size = 7;
   auto offset = 0;
   auto gCellPatterns = design_->getTopBlock()->getGCellPatterns();
@@ -1032,6 +1049,9 @@ void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
   auto& ygp = gCellPatterns.at(1);
   for (int i = offset; i < (int) xgp.getCount(); i += size) {
     for (int j = offset; j < (int) ygp.getCount(); j += size) {
+      if (tileMarkers.find({i, j}) != tileMarkers.end()) {
+        continue;
+      }
       Rect routeBox1 = design_->getTopBlock()->getGCellBox(Point(i, j));
       const int max_i = std::min((int) xgp.getCount() - 1, i + size - 1);
       const int max_j = std::min((int) ygp.getCount(), j + size - 1);
@@ -1053,58 +1073,149 @@ void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
       gcWorker->setExtBox(extBox);
       if (workersBatches.back().size() >= BATCHSIZE) {
         workersBatches.emplace_back();
+        tilesBatches.emplace_back();
       }
       workersBatches.back().push_back(std::move(gcWorker));
+      tilesBatches.back().emplace_back(i, j);
     }
   }
-  std::map<MarkerId, frMarker*> mapMarkers;
   omp_set_num_threads(MAX_THREADS);
-  for (auto& workers : workersBatches) {
+  for (size_t batch = 0; batch < workersBatches.size(); batch++) {
+    auto& workers = workersBatches[batch];
 #pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < workers.size(); i++) {  // NOLINT
       workers[i]->init(design_.get());
       workers[i]->main();
     }
-    for (const auto& worker : workers) {
-      for (auto& marker : worker->getMarkers()) {
-        Rect bbox = marker->getBBox();
-        if (!bbox.intersects(requiredDrcBox)) {
-          continue;
-        }
-        auto layerNum = marker->getLayerNum();
-        auto con = marker->getConstraint();
-        if (mapMarkers.find({bbox, layerNum, con, marker->getSrcs()})
-            != mapMarkers.end()) {
-          continue;
-        }
-        markers.push_back(std::make_unique<frMarker>(*marker));
-        mapMarkers[{bbox, layerNum, con, marker->getSrcs()}]
-            = markers.back().get();
+    for (size_t i = 0; i < workers.size(); i++) {
+      auto& tile = tileMarkers[tilesBatches[batch][i]];
+      for (auto& marker : workers[i]->getMarkers()) {
+        tile.push_back(std::make_unique<frMarker>(*marker));
       }
     }
     workers.clear();
   }
 }
 
-void TritonRoute::checkDRC(const char* filename, int x1, int y1, int x2, int y2)
+void TritonRoute::collectDRCMarkers(
+    const TileMarkers& tileMarkers,
+    const Rect& requiredDrcBox,
+    frList<std::unique_ptr<frMarker>>& markers)
+{
+  std::map<MarkerId, frMarker*> mapMarkers;
+  for (const auto& [tile, tileMarkersList] : tileMarkers) {
+    for (const auto& marker : tileMarkersList) {
+      Rect bbox = marker->getBBox();
+      if (!bbox.intersects(requiredDrcBox)) {
+        continue;
+      }
+      auto layerNum = marker->getLayerNum();
+      auto con = marker->getConstraint();
+      if (mapMarkers.find({bbox, layerNum, con, marker->getSrcs()})
+          != mapMarkers.end()) {
+        continue;
+      }
+      markers.push_back(std::make_unique<frMarker>(*marker));
+      mapMarkers[{bbox, layerNum, con, marker->getSrcs()}]
+          = markers.back().get();
+    }
+  }
+}
+
+void TritonRoute::invalidateDRCTiles(const std::vector<Rect>& changedBoxes)
+{
+  const int size = 7;
+  auto topBlock = design_->getTopBlock();
+  for (const Rect& changedBox : changedBoxes) {
+    // a tile sees every shape within MTSAFEDIST of its route box
+    Rect box;
+    changedBox.bloat(MTSAFEDIST, box);
+    const Point ll = topBlock->getGCellIdx(box.ll());
+    const Point ur = topBlock->getGCellIdx(box.ur());
+    for (int i = ll.x() / size * size; i <= ur.x(); i += size) {
+      for (int j = ll.y() / size * size; j <= ur.y(); j += size) {
+        drc_tile_markers_.erase({i, j});
+      }
+    }
+  }
+}
+
+void TritonRoute::checkDRC(const char* filename,
+                           int x1,
+                           int y1,
+                           int x2,
+                           int y2,
+                           bool incremental)
 {
   GC_IGNORE_PDN_LAYER_NUM = -1;
   REPAIR_PDN_LAYER_NUM = -1;
-  initDesign();
-  auto gcellGrid = db_->getChip()->getBlock()->getGCellGrid();
-  if (gcellGrid != nullptr && gcellGrid->getNumGridPatternsX() == 1
-      && gcellGrid->getNumGridPatternsY() == 1) {
+  MAX_THREADS = ord::OpenRoad::openRoad()->getThreadCount();
+  const bool reuse = incremental && !drc_tile_markers_.empty()
+                     && design_->getTopBlock() != nullptr
+                     && db_callback_->isTracking()
+                     && !db_callback_->hasStructuralChanges();
+  if (reuse) {
+    // only the nets, shapes and instances changed since the last check
+    std::vector<Rect> changedBoxes = db_callback_->getChangedBoxes();
     io::Parser parser(db_, getDesign(), logger_);
-    parser.buildGCellPatterns(db_);
-  } else if (!initGuide()) {
-    logger_->error(DRT, 1, "GCELLGRID is undefined");
+    parser.updateNets(db_callback_->getChangedNets(), changedBoxes);
+    const auto& changedSNets = db_callback_->getChangedSNets();
+    if (!changedSNets.empty() || db_callback_->hasObstructionChanges()) {
+      parser.updateSNets(changedSNets, changedBoxes);
+      if (db_callback_->hasObstructionChanges()) {
+        parser.updateObstructions(db_->getChip()->getBlock(), changedBoxes);
+      }
+      // special nets and blockages live in the fixed shapes
+      design_->getRegionQuery()->init();
+    }
+    invalidateDRCTiles(changedBoxes);
+    logger_->info(DRT,
+                  623,
+                  "Incremental DRC check of {} changed nets, {} changed "
+                  "special nets and {} changed regions.",
+                  db_callback_->getChangedNets().size(),
+                  changedSNets.size(),
+                  db_callback_->getChangedBoxes().size());
+    db_callback_->clearChanges();
+  } else {
+    std::set<odb::dbNet*> changedNets;
+    if (db_callback_->isTracking()) {
+      changedNets = db_callback_->getChangedNets();
+    }
+    db_callback_->stopTracking();
+    drc_tile_markers_.clear();
+    if (incremental && design_->getTopBlock() != nullptr) {
+      // The incremental session keeps its tiles in sync with odb, and
+      // updateDesign() misses obstructions, pins and special wires.
+      io::Parser parser(db_, getDesign(), logger_);
+      parser.reloadDesign(db_, changedNets);
+    } else {
+      initDesign();
+    }
+    auto gcellGrid = db_->getChip()->getBlock()->getGCellGrid();
+    if (gcellGrid != nullptr && gcellGrid->getNumGridPatternsX() == 1
+        && gcellGrid->getNumGridPatternsY() == 1) {
+      io::Parser parser(db_, getDesign(), logger_);
+      parser.buildGCellPatterns(db_);
+    } else if (!initGuide()) {
+      logger_->error(DRT, 1, "GCELLGRID is undefined");
+    }
   }
   Rect requiredDrcBox(x1, y1, x2, y2);
   if (requiredDrcBox.area() == 0) {
     requiredDrcBox = design_->getTopBlock()->getBBox();
   }
   frList<std::unique_ptr<frMarker>> markers;
-  getDRCMarkers(markers, requiredDrcBox);
+  if (incremental) {
+    checkDRCTiles(requiredDrcBox, drc_tile_markers_);
+    collectDRCMarkers(drc_tile_markers_, requiredDrcBox, markers);
+    // changes from here on are picked up by the next incremental check
+    if (!reuse) {
+      db_callback_->startTracking();
+    }
+  } else {
+    getDRCMarkers(markers, requiredDrcBox);
+  }
   reportDRC(filename, markers, requiredDrcBox);
 }
 
@@ -1324,6 +1435,9 @@ void TritonRoute::setParams(const ParamStruct& params)
   }
   SAVE_GUIDE_UPDATES = params.saveGuideUpdates;
   REPAIR_PDN_LAYER_NAME = params.repairPDNLayerName;
+  DR_DYNAMIC_SCHEDULING = params.dynamicScheduling;
+  TA_PANEL_COLORING = params.taPanelColoring;
+  PA_CACHE_FILE = params.pinAccessCacheFile;
 }
 
 void TritonRoute::addWorkerResults(
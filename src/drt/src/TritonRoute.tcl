@@ -59,6 +59,9 @@ sta::define_cmd_args "detailed_route" {
     [-min_access_points count]
     [-save_guide_updates]
     [-repair_pdn_vias layer]
+    [-dynamic_scheduling]
+    [-ta_panel_coloring]
+    [-pin_access_cache file]
     [-single_step_dr]
 }
 
@@ -68,9 +71,11 @@ proc detailed_route { args } {
       -db_process_node -droute_end_iter -via_in_pin_bottom_layer \
       -via_in_pin_top_layer -or_seed -or_k -bottom_routing_layer \
       -top_routing_layer -verbose -remote_host -remote_port -shared_volume \
-      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step} \
+      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step \
+      -pin_access_cache} \
     flags {-disable_via_gen -distributed -clean_patches -no_pin_access \
-           -single_step_dr -save_guide_updates}
+           -single_step_dr -save_guide_updates -dynamic_scheduling \
+           -ta_panel_coloring}
   sta::check_argc_eq0 "detailed_route" $args
 
   set enable_via_gen [expr ![info exists flags(-disable_via_gen)]]
@@ -80,6 +85,13 @@ proc detailed_route { args } {
   # development.  It is not listed in the help string intentionally.
   set single_step_dr [expr [info exists flags(-single_step_dr)]]
   set save_guide_updates [expr [info exists flags(-save_guide_updates)]]
+  set dynamic_scheduling [expr [info exists flags(-dynamic_scheduling)]]
+  set ta_panel_coloring [expr [info exists flags(-ta_panel_coloring)]]
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
 
   if { [info exists keys(-repair_pdn_vias)] } {
     set repair_pdn_vias $keys(-repair_pdn_vias)
@@ -197,7 +209,8 @@ proc detailed_route { args } {
     $via_in_pin_bottom_layer $via_in_pin_top_layer \
     $or_seed $or_k $bottom_routing_layer $top_routing_layer $verbose \
     $clean_patches $no_pin_access $single_step_dr $min_access_points \
-    $save_guide_updates $repair_pdn_vias $drc_report_iter_step
+    $save_guide_updates $repair_pdn_vias $drc_report_iter_step \
+    $dynamic_scheduling $ta_panel_coloring $pin_access_cache
 }
 
 proc detailed_route_num_drvs { args } {
@@ -298,11 +311,13 @@ sta::define_cmd_args "pin_access" {
     [-remote_port rport]
     [-shared_volume vol]
     [-cloud_size sz]
+    [-pin_access_cache file]
 }
 proc pin_access { args } {
   sta::parse_key_args "pin_access" args \
     keys {-db_process_node -bottom_routing_layer -top_routing_layer -verbose \
-          -min_access_points -remote_host -remote_port -shared_volume -cloud_size } \
+          -min_access_points -remote_host -remote_port -shared_volume -cloud_size \
+          -pin_access_cache } \
     flags {-distributed}
   sta::check_argc_eq0 "detailed_route_debug" $args
   if {[info exists keys(-db_process_node)]} {
@@ -332,6 +347,11 @@ proc pin_access { args } {
   } else {
     set min_access_points -1
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
   if { [info exists flags(-distributed)] } {
     if { [info exists keys(-remote_host)] } {
       set rhost $keys(-remote_host)
@@ -356,7 +376,7 @@ proc pin_access { args } {
     drt::detailed_route_distributed $rhost $rport $vol $cloudsz
   }
   drt::pin_access_cmd $db_process_node $bottom_routing_layer \
-    $top_routing_layer $verbose $min_access_points
+    $top_routing_layer $verbose $min_access_points $pin_access_cache
 }
 
 sta::define_cmd_args "detailed_route_run_worker" {
@@ -474,11 +494,12 @@ proc step_dr { args } {
 sta::define_cmd_args "check_drc" {
     [-box box]
     [-output_file filename]
+    [-incremental]
 };# checker off
 proc check_drc { args } {
   sta::parse_key_args "check_drc" args \
     keys { -box -output_file } \
-    flags {};# checker off
+    flags { -incremental };# checker off
   sta::check_argc_eq0 "check_drc" $args
   set box { 0 0 0 0 }
   if {[info exists keys(-box)]} {
@@ -493,7 +514,8 @@ proc check_drc { args } {
   } else {
     utl::error DRT 613 "-output_file is required for check_drc command"
   }
-  drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2
+  drt::check_drc_cmd $output_file $x1 $y1 $x2 $y2 \
+    [info exists flags(-incremental)]
 }
 
 }
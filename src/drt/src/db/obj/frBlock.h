@@ -385,6 +385,14 @@ class frBlock : public frBlockObject
     in->setId(upcoming_blkg_id_++);
     blockages_.push_back(std::move(in));
   }
+  void removeBlockage(frBlockage* in)
+  {
+    const int idx = in->getIndexInOwner();
+    blockages_.erase(blockages_.begin() + idx);
+    for (int i = idx; i < (int) blockages_.size(); i++) {
+      blockages_[i]->setIndexInOwner(i);
+    }
+  }
   void setGCellPatterns(const std::vector<frGCellPattern>& gpIn)
   {
     gCellPatterns_ = gpIn;
@@ -402,6 +410,14 @@ class frBlock : public frBlockObject
   {
     fakeSNets_.push_back(std::move(in));
   }
+  void addTrackPattern(std::unique_ptr<frTrackPattern> in)
+  {
+    const frLayerNum layerNum = in->getLayerNum();
+    if ((int) trackPatterns_.size() <= layerNum) {
+      trackPatterns_.resize(layerNum + 1);
+    }
+    trackPatterns_[layerNum].push_back(std::move(in));
+  }
   // others
   frBlockObjectEnum typeId() const override { return frcBlock; }
 
@@ -35,6 +35,7 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/io/ios_state.hpp>
 #include <chrono>
+#include <cmath>
 #include <cstdio>
 #include <fstream>
 #include <iomanip>
@@ -213,6 +214,10 @@ int FlexDRWorker::main(frDesign* design)
                     routeBox_.xMax() * micronPerDBU,
                     routeBox_.yMax() * micronPerDBU);
   }
+  std::shared_lock<std::shared_mutex> design_lock;
+  if (design_mutex_) {
+    design_lock = std::shared_lock<std::shared_mutex>(*design_mutex_);
+  }
   initMarkers(design);
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
     skipRouting_ = true;
@@ -266,8 +271,13 @@ int FlexDRWorker::main(frDesign* design)
   }
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
   if (!skipRouting_) {
+    // Routing still reads the design, e.g. the access points of the nets'
+    // pins, which end() of other workers may change.
     route_queue();
   }
+  if (design_lock.owns_lock()) {
+    design_lock.unlock();
+  }
   high_resolution_clock::time_point t2 = high_resolution_clock::now();
   const int num_markers = getNumMarkers();
   cleanup();
@@ -555,6 +565,140 @@ void FlexDR::getBatchInfo(int& batchStepX, int& batchStepY)
   batchStepY = 2;
 }
 
+void FlexDR::runWorkersByDependency(
+    std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+    const int numX,
+    const int numY,
+    const int batchStepX,
+    const int batchStepY,
+    const std::function<void()>& workerDone,
+    std::vector<double>& runtimes)
+{
+  // A worker only overlaps the workers of the adjacent clips.  It may start
+  // as soon as the neighbours that precede it in the batch order have been
+  // committed, so every region sees the same sequence of updates as with
+  // batches but no worker waits on an unrelated slow one.
+  const auto batchIdx = [batchStepX, batchStepY](int x, int y) {
+    return (x % batchStepX) * batchStepY + y % batchStepY;
+  };
+  const int numWorkers = workers.size();
+  std::vector<int> pending(numWorkers, 0);
+  std::vector<std::vector<int>> dependents(numWorkers);
+  for (int x = 0; x < numX; x++) {
+    for (int y = 0; y < numY; y++) {
+      const int idx = x * numY + y;
+      for (int nx = std::max(0, x - 1); nx <= std::min(numX - 1, x + 1); nx++) {
+        for (int ny = std::max(0, y - 1); ny <= std::min(numY - 1, y + 1);
+             ny++) {
+          if (batchIdx(nx, ny) < batchIdx(x, y)) {
+            pending[idx]++;
+            dependents[nx * numY + ny].push_back(idx);
+          }
+        }
+      }
+    }
+  }
+  std::vector<int> ready;
+  for (int idx = 0; idx < numWorkers; idx++) {
+    if (pending[idx] == 0) {
+      ready.push_back(idx);
+    }
+  }
+
+  runtimes.resize(numWorkers, 0.0);
+  // main() holds it shared while initializing and routing, end()
+  // exclusively
+  std::shared_mutex design_mutex;
+  ThreadException exception;
+  std::function<void(int)> runWorker = [&](const int idx) {
+    std::vector<int> released;
+    try {
+      auto& worker = workers[idx];
+      worker->setDesignMutex(&design_mutex);
+      const auto start = std::chrono::steady_clock::now();
+      worker->main(getDesign());
+      const std::chrono::duration<double> runtime
+          = std::chrono::steady_clock::now() - start;
+      runtimes[idx] = runtime.count();
+      {
+        std::unique_lock<std::shared_mutex> lock(design_mutex);
+        if (worker->end(getDesign())) {
+          numWorkUnits_ += 1;
+        }
+        if (worker->isCongested()) {
+          increaseClipsize_ = true;
+        }
+        workerDone();
+        for (const int dependent : dependents[idx]) {
+          if (--pending[dependent] == 0) {
+            released.push_back(dependent);
+          }
+        }
+      }
+      worker.reset();
+    } catch (...) {
+      exception.capture();
+    }
+    for (const int dependent : released) {
+#pragma omp task firstprivate(dependent)
+      runWorker(dependent);
+    }
+  };
+
+#pragma omp parallel
+#pragma omp single
+  for (const int idx : ready) {
+#pragma omp task firstprivate(idx)
+    runWorker(idx);
+  }
+  exception.rethrow();
+}
+
+void FlexDR::reportWorkerRuntimes(const std::vector<double>& runtimes) const
+{
+  if (runtimes.empty() || !logger_->debugCheck(DRT, "workers", 1)) {
+    return;
+  }
+  // Bucket 0 holds runtimes below 1ms, bucket i those in [2^(i-1), 2^i) ms
+  std::vector<int> buckets;
+  double total = 0;
+  double longest = 0;
+  for (const double runtime : runtimes) {
+    total += runtime;
+    longest = std::max(longest, runtime);
+    const double ms = runtime * 1e3;
+    const int bucket = ms < 1 ? 0 : 1 + (int) std::floor(std::log2(ms));
+    if (bucket >= (int) buckets.size()) {
+      buckets.resize(bucket + 1, 0);
+    }
+    buckets[bucket]++;
+  }
+  debugPrint(logger_,
+             DRT,
+             "workers",
+             1,
+             "Worker runtimes: {} workers, average {:.3f}s, longest {:.3f}s.",
+             runtimes.size(),
+             total / runtimes.size(),
+             longest);
+  for (int bucket = 0; bucket < (int) buckets.size(); bucket++) {
+    if (buckets[bucket] == 0) {
+      continue;
+    }
+    const std::string range
+        = bucket == 0 ? std::string("< 1ms")
+                      : fmt::format("{}-{}ms", 1 << (bucket - 1), 1 << bucket);
+    debugPrint(logger_,
+               DRT,
+               "workers",
+               1,
+               "  {:>14} {:>7} {:>6.1f}%",
+               range,
+               buckets[bucket],
+               100.0 * buckets[bucket] / runtimes.size());
+  }
+}
+
 void FlexDR::searchRepair(const SearchRepairArgs& args)
 {
   const int iter = iter_++;
@@ -607,7 +751,9 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   int prev_perc = 0;
   bool isExceed = false;
 
+  // Workers in row-major (x, y) clip order, used by the dependency scheduler
   std::vector<std::unique_ptr<FlexDRWorker>> uworkers;
+  const bool dependencyScheduling = DR_DYNAMIC_SCHEDULING && !dist_on_;
   int batchStepX, batchStepY;
 
   getBatchInfo(batchStepX, batchStepY);
@@ -660,14 +806,18 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
                       workerFixedShapeCost,
                       workerMarkerDecay);
 
-      int batchIdx = (xIdx % batchStepX) * batchStepY + yIdx % batchStepY;
-      if (workers[batchIdx].empty()
-          || (!dist_on_
-              && (int) workers[batchIdx].back().size() >= BATCHSIZE)) {
-        workers[batchIdx].push_back(
-            std::vector<std::unique_ptr<FlexDRWorker>>());
+      if (dependencyScheduling) {
+        uworkers.push_back(std::move(worker));
+      } else {
+        int batchIdx = (xIdx % batchStepX) * batchStepY + yIdx % batchStepY;
+        if (workers[batchIdx].empty()
+            || (!dist_on_
+                && (int) workers[batchIdx].back().size() >= BATCHSIZE)) {
+          workers[batchIdx].push_back(
+              std::vector<std::unique_ptr<FlexDRWorker>>());
+        }
+        workers[batchIdx].back().push_back(std::move(worker));
       }
-      workers[batchIdx].back().push_back(std::move(worker));
 
       yIdx++;
     }
@@ -679,6 +829,31 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   int version = 0;
   increaseClipsize_ = false;
   numWorkUnits_ = 0;
+  std::vector<double> runtimes;
+  // called serially after each worker completes
+  const auto workerDone = [&]() {
+    cnt++;
+    if (VERBOSE > 0) {
+      if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1 && prev_perc < 90) {
+        if (prev_perc == 0 && t.isExceed(0)) {
+          isExceed = true;
+        }
+        prev_perc += 10;
+        if (isExceed) {
+          logger_->report("    Completing {}% with {} violations.",
+                          prev_perc,
+                          getDesign()->getTopBlock()->getNumMarkers());
+          logger_->report("    {}.", t);
+        }
+      }
+    }
+  };
+  if (dependencyScheduling) {
+    ProfileTask profile("DR:dependency_scheduling");
+    const int numY = ((int) ygp.getCount() - 1 - offset) / size + 1;
+    runWorkersByDependency(
+        uworkers, xIdx, numY, batchStepX, batchStepY, workerDone, runtimes);
+  }
   // parallel execution
   for (auto& workerBatch : workers) {
     ProfileTask profile("DR:checkerboard");
@@ -705,30 +880,18 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
 #pragma omp parallel for schedule(dynamic)
           for (int i = 0; i < (int) workersInBatch.size(); i++) {  // NOLINT
             try {
+              const auto start = std::chrono::steady_clock::now();
               if (dist_on_) {
                 workersInBatch[i]->distributedMain(getDesign());
               } else {
                 workersInBatch[i]->main(getDesign());
               }
+              const std::chrono::duration<double> runtime
+                  = std::chrono::steady_clock::now() - start;
 #pragma omp critical
               {
-                cnt++;
-                if (VERBOSE > 0) {
-                  if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1
-                      && prev_perc < 90) {
-                    if (prev_perc == 0 && t.isExceed(0)) {
-                      isExceed = true;
-                    }
-                    prev_perc += 10;
-                    if (isExceed) {
-                      logger_->report(
-                          "    Completing {}% with {} violations.",
-                          prev_perc,
-                          getDesign()->getTopBlock()->getNumMarkers());
-                      logger_->report("    {}.", t);
-                    }
-                  }
-                }
+                runtimes.push_back(runtime.count());
+                workerDone();
               }
             } catch (...) {
               exception.capture();
@@ -784,6 +947,8 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
     }
   }
 
+  reportWorkerRuntimes(runtimes);
+
   if (!iter) {
     removeGCell2BoundaryPin();
   }
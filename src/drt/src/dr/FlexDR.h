@@ -33,7 +33,9 @@
 #include <boost/polygon/polygon.hpp>
 #include <boost/serialization/export.hpp>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <shared_mutex>
 
 #include "db/drObj/drMarker.h"
 #include "db/drObj/drNet.h"
@@ -163,6 +165,15 @@ class FlexDR
   void initFromTA();
   void initGCell2BoundaryPin();
   void getBatchInfo(int& batchStepX, int& batchStepY);
+  void runWorkersByDependency(
+      std::vector<std::unique_ptr<FlexDRWorker>>& workers,
+      int numX,
+      int numY,
+      int batchStepX,
+      int batchStepY,
+      const std::function<void()>& workerDone,
+      std::vector<double>& runtimes);
+  void reportWorkerRuntimes(const std::vector<double>& runtimes) const;
 
   void init_halfViaEncArea();
 
@@ -261,6 +272,8 @@ class FlexDRWorker
   {
     debugSettings_ = settings;
   }
+  // Guards reads of the design while other workers commit concurrently
+  void setDesignMutex(std::shared_mutex* mutex) { design_mutex_ = mutex; }
   void setRouteBox(const Rect& boxIn) { routeBox_ = boxIn; }
   void setExtBox(const Rect& boxIn) { extBox_ = boxIn; }
   void setDrcBox(const Rect& boxIn) { drcBox_ = boxIn; }
@@ -452,6 +465,7 @@ class FlexDRWorker
   FlexDRGraphics* graphics_ = nullptr;  // owned by FlexDR
   frDebugSettings* debugSettings_ = nullptr;
   FlexDRViaData* via_data_ = nullptr;
+  std::shared_mutex* design_mutex_ = nullptr;
   Rect routeBox_;
   Rect extBox_;
   Rect drcBox_;
@@ -72,20 +72,10 @@ void FlexGridGraph::initGrids(
 
   nodes_.clear();
   nodes_.resize(capacity, Node());
-  // new
-  prevDirs_.clear();
-  srcs_.clear();
-  dsts_.clear();
-
-  prevDirs_.resize(capacity * 3, false);
-  srcs_.resize(capacity, false);
-  dsts_.resize(capacity, false);
-  guides_.clear();
-  if (followGuide) {
-    guides_.resize(capacity, false);
-  } else {
-    guides_.resize(capacity, true);
-  }
+  NodeState state{};
+  state.hasGuide = !followGuide;
+  states_.clear();
+  states_.resize(capacity, state);
 }
 
 bool FlexGridGraph::outOfDieVia(frMIdx x,
@@ -443,24 +433,32 @@ void FlexGridGraph::initTracks(
 
 void FlexGridGraph::resetStatus()
 {
-  resetSrc();
-  resetDst();
-  resetPrevNodeDir();
+  for (NodeState& state : states_) {
+    state.prevDir = (uint8_t) frDirEnum::UNKNOWN;
+    state.isSrc = false;
+    state.isDst = false;
+  }
 }
 
 void FlexGridGraph::resetSrc()
 {
-  srcs_.assign(srcs_.size(), false);
+  for (NodeState& state : states_) {
+    state.isSrc = false;
+  }
 }
 
 void FlexGridGraph::resetDst()
 {
-  dsts_.assign(dsts_.size(), false);
+  for (NodeState& state : states_) {
+    state.isDst = false;
+  }
 }
 
 void FlexGridGraph::resetPrevNodeDir()
 {
-  prevDirs_.assign(prevDirs_.size(), false);
+  for (NodeState& state : states_) {
+    state.prevDir = (uint8_t) frDirEnum::UNKNOWN;
+  }
 }
 
 // print the grid graph with edge and vertex for debug purpose
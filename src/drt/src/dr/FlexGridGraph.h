@@ -646,16 +646,22 @@ class FlexGridGraph
   }
 
   // unsafe access, no idx check
-  void setSrc(frMIdx x, frMIdx y, frMIdx z) { srcs_[getIdx(x, y, z)] = true; }
+  void setSrc(frMIdx x, frMIdx y, frMIdx z)
+  {
+    states_[getIdx(x, y, z)].isSrc = true;
+  }
   void setSrc(const FlexMazeIdx& mi)
   {
-    srcs_[getIdx(mi.x(), mi.y(), mi.z())] = true;
+    states_[getIdx(mi.x(), mi.y(), mi.z())].isSrc = true;
   }
   // unsafe access, no idx check
-  void setDst(frMIdx x, frMIdx y, frMIdx z) { dsts_[getIdx(x, y, z)] = true; }
+  void setDst(frMIdx x, frMIdx y, frMIdx z)
+  {
+    states_[getIdx(x, y, z)].isDst = true;
+  }
   void setDst(const FlexMazeIdx& mi)
   {
-    dsts_[getIdx(mi.x(), mi.y(), mi.z())] = true;
+    states_[getIdx(mi.x(), mi.y(), mi.z())].isDst = true;
   }
   // unsafe access
   void setSVia(frMIdx x, frMIdx y, frMIdx z)
@@ -704,20 +710,20 @@ class FlexGridGraph
   // unsafe access, no idx check
   void resetSrc(frMIdx x, frMIdx y, frMIdx z)
   {
-    srcs_[getIdx(x, y, z)] = false;
+    states_[getIdx(x, y, z)].isSrc = false;
   }
   void resetSrc(const FlexMazeIdx& mi)
   {
-    srcs_[getIdx(mi.x(), mi.y(), mi.z())] = false;
+    states_[getIdx(mi.x(), mi.y(), mi.z())].isSrc = false;
   }
   // unsafe access, no idx check
   void resetDst(frMIdx x, frMIdx y, frMIdx z)
   {
-    dsts_[getIdx(x, y, z)] = false;
+    states_[getIdx(x, y, z)].isDst = false;
   }
   void resetDst(const FlexMazeIdx& mi)
   {
-    dsts_[getIdx(mi.x(), mi.y(), mi.z())] = false;
+    states_[getIdx(mi.x(), mi.y(), mi.z())].isDst = false;
   }
   void resetGridCost(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
@@ -743,7 +749,7 @@ class FlexGridGraph
   {
     reverse(x, y, z, dir);
     auto idx = getIdx(x, y, z);
-    return guides_[idx];
+    return states_[idx].hasGuide;
   }
   // must be safe access because idx1 and idx2 may be invalid
   void setGuide(frMIdx x1, frMIdx y1, frMIdx x2, frMIdx y2, frMIdx z)
@@ -754,16 +760,12 @@ class FlexGridGraph
     switch (getZDir(z)) {
       case dbTechLayerDir::HORIZONTAL:
         for (int i = y1; i <= y2; i++) {
-          auto idx1 = getIdx(x1, i, z);
-          auto idx2 = getIdx(x2, i, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 1);
+          setGuideRange(getIdx(x1, i, z), getIdx(x2, i, z), true);
         }
         break;
       case dbTechLayerDir::VERTICAL:
         for (int i = x1; i <= x2; i++) {
-          auto idx1 = getIdx(i, y1, z);
-          auto idx2 = getIdx(i, y2, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 1);
+          setGuideRange(getIdx(i, y1, z), getIdx(i, y2, z), true);
         }
         break;
       case dbTechLayerDir::NONE:
@@ -779,16 +781,12 @@ class FlexGridGraph
     switch (getZDir(z)) {
       case dbTechLayerDir::HORIZONTAL:
         for (int i = y1; i <= y2; i++) {
-          auto idx1 = getIdx(x1, i, z);
-          auto idx2 = getIdx(x2, i, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 0);
+          setGuideRange(getIdx(x1, i, z), getIdx(x2, i, z), false);
         }
         break;
       case dbTechLayerDir::VERTICAL:
         for (int i = x1; i <= x2; i++) {
-          auto idx1 = getIdx(i, y1, z);
-          auto idx2 = getIdx(i, y2, z);
-          std::fill(guides_.begin() + idx1, guides_.begin() + idx2 + 1, 0);
+          setGuideRange(getIdx(i, y1, z), getIdx(i, y2, z), false);
         }
         break;
       case dbTechLayerDir::NONE:
@@ -862,12 +860,8 @@ class FlexGridGraph
   {
     nodes_.clear();
     nodes_.shrink_to_fit();
-    srcs_.clear();
-    srcs_.shrink_to_fit();
-    dsts_.clear();
-    dsts_.shrink_to_fit();
-    guides_.clear();
-    guides_.shrink_to_fit();
+    states_.clear();
+    states_.shrink_to_fit();
     xCoords_.clear();
     xCoords_.shrink_to_fit();
     yCoords_.clear();
@@ -960,11 +954,21 @@ class FlexGridGraph
 #ifndef DEBUG_DRT_UNDERFLOW
   static_assert(sizeof(Node) == 12);
 #endif
+  // Search state of a node, i.e. everything the maze search writes.  It is
+  // kept in one byte next to its neighbours' rather than in separate bit
+  // vectors so an expansion touches a single array besides nodes_, and
+  // resetting it between searches is one pass.
+  struct NodeState
+  {
+    uint8_t prevDir : 3;  // frDirEnum
+    uint8_t isSrc : 1;
+    uint8_t isDst : 1;
+    uint8_t hasGuide : 1;
+    uint8_t unused : 2;
+  };
+  static_assert(sizeof(NodeState) == 1);
   frVector<Node> nodes_;
-  std::vector<bool> prevDirs_;
-  std::vector<bool> srcs_;
-  std::vector<bool> dsts_;
-  std::vector<bool> guides_;
+  frVector<NodeState> states_;
   frVector<frCoord> xCoords_;
   frVector<frCoord> yCoords_;
   frVector<frLayerNum> zCoords_;
@@ -988,38 +992,39 @@ class FlexGridGraph
   // unsafe access, no idx check
   void setPrevAstarNodeDir(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir)
   {
-    auto baseIdx = 3 * getIdx(x, y, z);
-    prevDirs_[baseIdx] = ((uint16_t) dir >> 2) & 1;
-    prevDirs_[baseIdx + 1] = ((uint16_t) dir >> 1) & 1;
-    prevDirs_[baseIdx + 2] = ((uint16_t) dir) & 1;
+    states_[getIdx(x, y, z)].prevDir = (uint8_t) dir;
   }
 
   // unsafe access, no check
   frDirEnum getPrevAstarNodeDir(const FlexMazeIdx& idx) const
   {
-    auto baseIdx = 3 * getIdx(idx.x(), idx.y(), idx.z());
-    return (frDirEnum) (((uint16_t) (prevDirs_[baseIdx]) << 2)
-                        + ((uint16_t) (prevDirs_[baseIdx + 1]) << 1)
-                        + ((uint16_t) (prevDirs_[baseIdx + 2]) << 0));
+    return (frDirEnum) states_[getIdx(idx.x(), idx.y(), idx.z())].prevDir;
   }
 
   // unsafe access, no check
   bool isSrc(frMIdx x, frMIdx y, frMIdx z) const
   {
-    return srcs_[getIdx(x, y, z)];
+    return states_[getIdx(x, y, z)].isSrc;
   }
   // unsafe access, no check
   bool isDst(frMIdx x, frMIdx y, frMIdx z) const
   {
-    return dsts_[getIdx(x, y, z)];
+    return states_[getIdx(x, y, z)].isDst;
   }
   bool isDst(frMIdx x, frMIdx y, frMIdx z, frDirEnum dir) const
   {
     getNextGrid(x, y, z, dir);
-    bool b = dsts_[getIdx(x, y, z)];
+    bool b = states_[getIdx(x, y, z)].isDst;
     getPrevGrid(x, y, z, dir);
     return b;
   }
+  // inclusive range of indices
+  void setGuideRange(frMIdx idx1, frMIdx idx2, bool value)
+  {
+    for (frMIdx idx = idx1; idx <= idx2; idx++) {
+      states_[idx].hasGuide = value;
+    }
+  }
 
   // internal getters
   frMIdx getIdx(frMIdx xIdx, frMIdx yIdx, frMIdx zIdx) const
@@ -1209,10 +1214,7 @@ class FlexGridGraph
     }
     (ar) & drWorker_;
     (ar) & nodes_;
-    (ar) & prevDirs_;
-    (ar) & srcs_;
-    (ar) & dsts_;
-    (ar) & guides_;
+    (ar) & states_;
     (ar) & xCoords_;
     (ar) & yCoords_;
     (ar) & zCoords_;
@@ -29,8 +29,10 @@
 #pragma once
 
 #include <bitset>
+#include <map>
 #include <memory>
 #include <queue>
+#include <vector>
 
 #include "dr/FlexMazeTypes.h"
 #include "frBaseTypes.h"
@@ -76,7 +78,30 @@ class FlexWavefrontGrid
     if (zIdx_ != b.zIdx_) {
       return zIdx_ < b.zIdx_;  // prefer upper layer
     }
-    return pathCost_ < b.pathCost_;  // prefer larger pathcost, DFS-style
+    if (pathCost_ != b.pathCost_) {
+      return pathCost_ < b.pathCost_;  // prefer larger pathcost, DFS-style
+    }
+    // The remaining keys only make the order total, so that the grid popped
+    // does not depend on the order of the pushes.
+    if (xIdx_ != b.xIdx_) {
+      return xIdx_ > b.xIdx_;
+    }
+    if (yIdx_ != b.yIdx_) {
+      return yIdx_ > b.yIdx_;
+    }
+    if (prevViaUp_ != b.prevViaUp_) {
+      return prevViaUp_ > b.prevViaUp_;
+    }
+    if (vLengthX_ != b.vLengthX_) {
+      return vLengthX_ > b.vLengthX_;
+    }
+    if (vLengthY_ != b.vLengthY_) {
+      return vLengthY_ > b.vLengthY_;
+    }
+    if (tLength_ != b.tLength_) {
+      return tLength_ > b.tLength_;
+    }
+    return backTraceBuffer_.to_ulong() > b.backTraceBuffer_.to_ulong();
   }
   // getters
   frMIdx x() const { return xIdx_; }
@@ -150,6 +175,64 @@ class myPriorityQueue : public std::priority_queue<FlexWavefrontGrid>
   }
 };
 
+#ifdef DRT_BUCKET_WAVEFRONT
+// Grids bucketed by cost, each bucket ordered by the remaining keys of
+// FlexWavefrontGrid::operator<.  As that order is total, the grids are
+// popped in the same order as from the single heap below.  The buckets are
+// kept in a map as pushed costs may be lower than the current minimum.
+class FlexWavefront
+{
+ public:
+  bool empty() const { return size_ == 0; }
+  const FlexWavefrontGrid& top() const
+  {
+    return buckets_.begin()->second.top();
+  }
+  void pop()
+  {
+    auto it = buckets_.begin();
+    it->second.pop();
+    if (it->second.empty()) {
+      spare_.push_back(std::move(it->second));
+      buckets_.erase(it);
+    }
+    --size_;
+  }
+  void push(const FlexWavefrontGrid& in)
+  {
+    auto [it, inserted] = buckets_.try_emplace(in.getCost());
+    if (inserted && !spare_.empty()) {
+      it->second = std::move(spare_.back());
+      spare_.pop_back();
+    }
+    it->second.push(in);
+    ++size_;
+  }
+  unsigned int size() const { return size_; }
+  void cleanup()
+  {
+    for (auto& [cost, bucket] : buckets_) {
+      bucket.cleanup();
+      spare_.push_back(std::move(bucket));
+    }
+    buckets_.clear();
+    size_ = 0;
+  }
+  void fit()
+  {
+    buckets_.clear();
+    spare_.clear();
+    spare_.shrink_to_fit();
+    size_ = 0;
+  }
+
+ private:
+  std::map<frCost, myPriorityQueue> buckets_;
+  // emptied buckets, reused to avoid reallocating their storage
+  std::vector<myPriorityQueue> spare_;
+  unsigned int size_ = 0;
+};
+#else
 class FlexWavefront
 {
  public:
@@ -164,4 +247,5 @@ class FlexWavefront
  private:
   myPriorityQueue wavefrontPQ_;
 };
+#endif
 }  // namespace drt
@@ -71,6 +71,7 @@ class frDesign
   }
   // setters
   void setTopBlock(std::unique_ptr<frBlock> in) { topBlock_ = std::move(in); }
+  std::unique_ptr<frBlock> releaseTopBlock() { return std::move(topBlock_); }
   void setTech(std::unique_ptr<frTechObject> in) { tech_ = std::move(in); }
   void addMaster(std::unique_ptr<frMaster> in)
   {
@@ -28,10 +28,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/geometry/algorithms/covered_by.hpp>
 #include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/geometries/register/box.hpp>
 #include <boost/geometry/geometries/register/point.hpp>
+#include <cmath>
+#include <vector>
 
 #include "db/infra/frBox.h"
 #include "db/infra/frPoint.h"
@@ -55,4 +58,167 @@ namespace drt {
 template <typename T, typename Key = Rect>
 using RTree = bgi::rtree<std::pair<Key, T>, bgi::quadratic<16>>;
 
+// Read-mostly R-tree packed once from all its values.  The leaves are
+// filled in sort-tile-recursive order and every node's children are
+// consecutive, so the tree is a few flat arrays of boxes without per node
+// allocations.  Removed values are only marked; values added later belong
+// in a dynamic RTree next to it.
+template <typename T>
+class StaticRTree
+{
+ public:
+  using Value = std::pair<Rect, T>;
+
+  StaticRTree() = default;
+  explicit StaticRTree(std::vector<Value> values) : values_(std::move(values))
+  {
+    pack();
+  }
+
+  // Appends the values whose box intersects box, in packed order.
+  template <typename OutputIterator>
+  void query(const Rect& box, OutputIterator out) const
+  {
+    if (levels_.empty()) {
+      return;
+    }
+    const int top = levels_.size() - 1;
+    for (int node = 0; node < (int) levels_[top].size(); node++) {
+      query(box, top, node, out);
+    }
+  }
+
+  // Marks one value equal to value as removed.  Returns false if there is
+  // none.
+  bool remove(const Value& value)
+  {
+    if (levels_.empty()) {
+      return false;
+    }
+    const int top = levels_.size() - 1;
+    for (int node = 0; node < (int) levels_[top].size(); node++) {
+      if (remove(value, top, node)) {
+        num_removed_++;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  size_t size() const { return values_.size() - num_removed_; }
+  bool empty() const { return size() == 0; }
+
+ private:
+  static constexpr int kFanout = 16;
+
+  void pack()
+  {
+    const int num_values = values_.size();
+    if (num_values == 0) {
+      return;
+    }
+    const auto center_x = [](const Value& v) {
+      return (int64_t) v.first.xMin() + v.first.xMax();
+    };
+    const auto center_y = [](const Value& v) {
+      return (int64_t) v.first.yMin() + v.first.yMax();
+    };
+    std::stable_sort(values_.begin(),
+                     values_.end(),
+                     [&](const Value& a, const Value& b) {
+                       return center_x(a) < center_x(b);
+                     });
+    const int num_leaves = (num_values + kFanout - 1) / kFanout;
+    const int num_slices = std::ceil(std::sqrt(num_leaves));
+    const int slice_size
+        = ((num_leaves + num_slices - 1) / num_slices) * kFanout;
+    for (int begin = 0; begin < num_values; begin += slice_size) {
+      const int end = std::min(num_values, begin + slice_size);
+      std::stable_sort(values_.begin() + begin,
+                       values_.begin() + end,
+                       [&](const Value& a, const Value& b) {
+                         return center_y(a) < center_y(b);
+                       });
+    }
+    removed_.assign(num_values, false);
+
+    std::vector<Rect> level;
+    for (int begin = 0; begin < num_values; begin += kFanout) {
+      Rect bbox;
+      bbox.mergeInit();
+      const int end = std::min(num_values, begin + kFanout);
+      for (int i = begin; i < end; i++) {
+        bbox.merge(values_[i].first);
+      }
+      level.push_back(bbox);
+    }
+    levels_.push_back(std::move(level));
+    while (levels_.back().size() > kFanout) {
+      const std::vector<Rect>& children = levels_.back();
+      std::vector<Rect> parents;
+      for (int begin = 0; begin < (int) children.size(); begin += kFanout) {
+        Rect bbox = children[begin];
+        const int end = std::min((int) children.size(), begin + kFanout);
+        for (int i = begin + 1; i < end; i++) {
+          bbox.merge(children[i]);
+        }
+        parents.push_back(bbox);
+      }
+      levels_.push_back(std::move(parents));
+    }
+  }
+
+  int numChildren(const int level) const
+  {
+    return level == 0 ? values_.size() : levels_[level - 1].size();
+  }
+
+  template <typename OutputIterator>
+  void query(const Rect& box,
+             const int level,
+             const int node,
+             OutputIterator& out) const
+  {
+    if (!levels_[level][node].intersects(box)) {
+      return;
+    }
+    const int begin = node * kFanout;
+    const int end = std::min(numChildren(level), begin + kFanout);
+    for (int i = begin; i < end; i++) {
+      if (level > 0) {
+        query(box, level - 1, i, out);
+      } else if (!removed_[i] && values_[i].first.intersects(box)) {
+        *out++ = values_[i];
+      }
+    }
+  }
+
+  bool remove(const Value& value, const int level, const int node)
+  {
+    if (!levels_[level][node].contains(value.first)) {
+      return false;
+    }
+    const int begin = node * kFanout;
+    const int end = std::min(numChildren(level), begin + kFanout);
+    for (int i = begin; i < end; i++) {
+      if (level > 0) {
+        if (remove(value, level - 1, i)) {
+          return true;
+        }
+      } else if (!removed_[i] && values_[i] == value) {
+        removed_[i] = true;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  std::vector<Value> values_;
+  std::vector<bool> removed_;
+  int num_removed_ = 0;
+  // levels_[0] bounds consecutive groups of values_, levels_[l] groups of
+  // the nodes of levels_[l - 1].
+  std::vector<std::vector<Rect>> levels_;
+};
+
 }  // namespace drt
@@ -28,13 +28,17 @@
 
 #include "frRegionQuery.h"
 
+#include <omp.h>
+
 #include <boost/polygon/polygon.hpp>
 #include <iostream>
+#include <tuple>
 
 #include "frDesign.h"
 #include "frRTree.h"
 #include "global.h"
 #include "utl/algorithms.h"
+#include "utl/exception.h"
 
 namespace drt {
 
@@ -51,8 +55,10 @@ struct frRegionQuery::Impl
 
   frDesign* design_;
   Logger* logger_;
-  // only for pin shapes, obs and snet
-  RTreesByLayer<frBlockObject*> shapes_;
+  // only for pin shapes, obs and snet; packed once by init()
+  std::vector<StaticRTree<frBlockObject*>> shapes_;
+  // instance shapes added after init(), e.g. of moved instances
+  RTreesByLayer<frBlockObject*> addedShapes_;
   RTreesByLayer<frGuide*> guides_;
   RTreesByLayer<frNet*> origGuides_;  // non-processed guides;
   RTree<frBlockObject*> grPins_;
@@ -72,6 +78,8 @@ struct frRegionQuery::Impl
   void initGRPin(std::vector<std::pair<frBlockObject*, Point>>& in);
   void initDRObj();
   void initGRObj();
+  template <typename T>
+  void bulkLoad(RTreesByLayer<T*>& trees, ObjectsByLayer<T>& allShapes);
 
   void add(frShape* shape, ObjectsByLayer<frBlockObject>& allShapes);
   void add(frVia* via, ObjectsByLayer<frBlockObject>& allShapes);
@@ -90,6 +98,11 @@ struct frRegionQuery::Impl
   void addGRObj(grVia* via, ObjectsByLayer<grBlockObject>& allShapes);
   void addGRObj(grShape* shape);
   void addGRObj(grVia* via);
+  void addShape(frLayerNum layerNum, const Rect& box, frBlockObject* obj);
+  void removeShape(frLayerNum layerNum, const Rect& box, frBlockObject* obj);
+  void queryShapes(const Rect& box,
+                   frLayerNum layerNum,
+                   Objects<frBlockObject>& result) const;
 };
 
 frRegionQuery::frRegionQuery(frDesign* design, Logger* logger)
@@ -172,8 +185,8 @@ void frRegionQuery::addBlockObj(frBlockObject* obj)
           auto shape = uFig.get();
           Rect frb = shape->getBBox();
           xform.apply(frb);
-          impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-              .insert(std::make_pair(frb, instTerm));
+          impl_->addShape(
+              static_cast<frShape*>(shape)->getLayerNum(), frb, instTerm);
         }
       }
       break;
@@ -188,8 +201,8 @@ void frRegionQuery::addBlockObj(frBlockObject* obj)
         if (shape->typeId() == frcPathSeg || shape->typeId() == frcRect) {
           Rect frb = shape->getBBox();
           xform.apply(frb);
-          impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-              .insert(std::make_pair(frb, instBlk));
+          impl_->addShape(
+              static_cast<frShape*>(shape)->getLayerNum(), frb, instBlk);
         } else if (shape->typeId() == frcPolygon) {
           // Decompose the polygon to rectangles and store those
           // Convert the frPolygon to a Boost polygon
@@ -212,8 +225,8 @@ void frRegionQuery::addBlockObj(frBlockObject* obj)
           // Store the rectangles with this blockage
           for (auto& rect : rects) {
             Rect box(xl(rect), yl(rect), xh(rect), yh(rect));
-            impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-                .insert(std::make_pair(box, instBlk));
+            impl_->addShape(
+                static_cast<frShape*>(shape)->getLayerNum(), box, instBlk);
           }
         }
       }
@@ -234,6 +247,23 @@ void frRegionQuery::addBlockObj(frBlockObject* obj)
   }
 }
 
+void frRegionQuery::Impl::addShape(const frLayerNum layerNum,
+                                   const Rect& box,
+                                   frBlockObject* obj)
+{
+  addedShapes_.at(layerNum).insert(std::make_pair(box, obj));
+}
+
+void frRegionQuery::Impl::removeShape(const frLayerNum layerNum,
+                                      const Rect& box,
+                                      frBlockObject* obj)
+{
+  const auto value = std::make_pair(box, obj);
+  if (addedShapes_.at(layerNum).remove(value) == 0) {
+    shapes_.at(layerNum).remove(value);
+  }
+}
+
 void frRegionQuery::removeBlockObj(frBlockObject* obj)
 {
   switch (obj->typeId()) {
@@ -245,8 +275,8 @@ void frRegionQuery::removeBlockObj(frBlockObject* obj)
           auto shape = uFig.get();
           Rect frb = shape->getBBox();
           xform.apply(frb);
-          impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-              .remove(std::make_pair(frb, instTerm));
+          impl_->removeShape(
+              static_cast<frShape*>(shape)->getLayerNum(), frb, instTerm);
         }
       }
       break;
@@ -261,8 +291,8 @@ void frRegionQuery::removeBlockObj(frBlockObject* obj)
         if (shape->typeId() == frcPathSeg || shape->typeId() == frcRect) {
           Rect frb = shape->getBBox();
           xform.apply(frb);
-          impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-              .remove(std::make_pair(frb, instBlk));
+          impl_->removeShape(
+              static_cast<frShape*>(shape)->getLayerNum(), frb, instBlk);
         } else if (shape->typeId() == frcPolygon) {
           // Decompose the polygon to rectangles and store those
           // Convert the frPolygon to a Boost polygon
@@ -285,8 +315,8 @@ void frRegionQuery::removeBlockObj(frBlockObject* obj)
           // Store the rectangles with this blockage
           for (auto& rect : rects) {
             Rect box(xl(rect), yl(rect), xh(rect), yh(rect));
-            impl_->shapes_.at(static_cast<frShape*>(shape)->getLayerNum())
-                .remove(std::make_pair(box, instBlk));
+            impl_->removeShape(
+                static_cast<frShape*>(shape)->getLayerNum(), box, instBlk);
           }
         }
       }
@@ -559,20 +589,52 @@ void frRegionQuery::Impl::addOrigGuide(frNet* net,
   allShapes.at(rect.getLayerNum()).push_back(std::make_pair(frb, net));
 }
 
+// The results are sorted so that their order does not depend on how the
+// shapes are split between the packed and the added trees.
+void frRegionQuery::Impl::queryShapes(const Rect& box,
+                                      const frLayerNum layerNum,
+                                      Objects<frBlockObject>& result) const
+{
+  const size_t first = result.size();
+  shapes_.at(layerNum).query(box, back_inserter(result));
+  addedShapes_.at(layerNum).query(bgi::intersects(box), back_inserter(result));
+  std::stable_sort(result.begin() + first,
+                   result.end(),
+                   [](const rq_box_value_t<frBlockObject*>& a,
+                      const rq_box_value_t<frBlockObject*>& b) {
+                     const Rect& ra = a.first;
+                     const Rect& rb = b.first;
+                     return std::make_tuple(ra.xMin(),
+                                            ra.yMin(),
+                                            ra.xMax(),
+                                            ra.yMax(),
+                                            a.second->typeId(),
+                                            a.second->getId())
+                            < std::make_tuple(rb.xMin(),
+                                              rb.yMin(),
+                                              rb.xMax(),
+                                              rb.yMax(),
+                                              b.second->typeId(),
+                                              b.second->getId());
+                   });
+}
+
 void frRegionQuery::query(const box_t& boostb,
                           const frLayerNum layerNum,
                           Objects<frBlockObject>& result) const
 {
-  impl_->shapes_.at(layerNum).query(bgi::intersects(boostb),
-                                    back_inserter(result));
+  const Rect box(bg::get<bg::min_corner, 0>(boostb),
+                 bg::get<bg::min_corner, 1>(boostb),
+                 bg::get<bg::max_corner, 0>(boostb),
+                 bg::get<bg::max_corner, 1>(boostb));
+  impl_->queryShapes(box, layerNum, result);
 }
 
 void frRegionQuery::query(const Rect& box,
                           const frLayerNum layerNum,
                           Objects<frBlockObject>& result) const
 {
-  impl_->shapes_.at(layerNum).query(bgi::intersects(box),
-                                    back_inserter(result));
+  impl_->queryShapes(box, layerNum, result);
 }
 
 void frRegionQuery::queryRPin(const Rect& box,
@@ -705,6 +767,21 @@ void frRegionQuery::queryMarker(const Rect& box,
   });
 }
 
+// Pack each layer's tree from its collected objects.  Layers are
+// independent, so they are packed concurrently.
+template <typename T>
+void frRegionQuery::Impl::bulkLoad(RTreesByLayer<T*>& trees,
+                                   ObjectsByLayer<T>& allShapes)
+{
+  omp_set_num_threads(MAX_THREADS);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < (int) allShapes.size(); i++) {
+    trees[i] = boost::move(RTree<T*>(allShapes[i]));
+    allShapes[i].clear();
+    allShapes[i].shrink_to_fit();
+  }
+}
+
 void frRegionQuery::init()
 {
   impl_->init();
@@ -715,34 +792,65 @@ void frRegionQuery::Impl::init()
   const frLayerNum numLayers = design_->getTech()->getLayers().size();
   shapes_.clear();
   shapes_.resize(numLayers);
+  addedShapes_.clear();
+  addedShapes_.resize(numLayers);
 
   markers_.clear();
   markers_.resize(numLayers);
 
   ObjectsByLayer<frBlockObject> allShapes(numLayers);
 
-  int cnt = 0;
-  for (auto& inst : design_->getTopBlock()->getInsts()) {
-    for (auto& instTerm : inst->getInstTerms()) {
-      add(instTerm.get(), allShapes);
+  // Instance shapes are collected in contiguous chunks, one per thread, and
+  // concatenated in chunk order so the packed trees match a serial build.
+  const auto& insts = design_->getTopBlock()->getInsts();
+  const int numInsts = insts.size();
+  const int numChunks = std::max(1, std::min(MAX_THREADS, numInsts));
+  std::vector<ObjectsByLayer<frBlockObject>> chunkShapes(
+      numChunks, ObjectsByLayer<frBlockObject>(numLayers));
+  omp_set_num_threads(MAX_THREADS);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(static, 1)
+  for (int chunk = 0; chunk < numChunks; chunk++) {
+    try {
+      const int begin = (int64_t) numInsts * chunk / numChunks;
+      const int end = (int64_t) numInsts * (chunk + 1) / numChunks;
+      for (int i = begin; i < end; i++) {
+        for (auto& instTerm : insts[i]->getInstTerms()) {
+          add(instTerm.get(), chunkShapes[chunk]);
+        }
+        for (auto& instBlk : insts[i]->getInstBlockages()) {
+          add(instBlk.get(), chunkShapes[chunk]);
+        }
+      }
+    } catch (...) {
+      exception.capture();
     }
-    for (auto& instBlk : inst->getInstBlockages()) {
-      add(instBlk.get(), allShapes);
+  }
+  exception.rethrow();
+  for (auto& shapes : chunkShapes) {
+    for (frLayerNum i = 0; i < numLayers; i++) {
+      allShapes[i].insert(allShapes[i].end(),
+                          shapes[i].begin(),
+                          shapes[i].end());
+      shapes[i].clear();
+      shapes[i].shrink_to_fit();
     }
-    cnt++;
-    if (VERBOSE > 0) {
+  }
+  if (VERBOSE > 0) {
+    // the progress a serial walk over the instances reports
+    int cnt = 100000;
+    while (cnt <= numInsts) {
       if (cnt < 1000000) {
-        if (cnt % 100000 == 0) {
-          logger_->info(DRT, 18, "  Complete {} insts.", cnt);
-        }
+        logger_->info(DRT, 18, "  Complete {} insts.", cnt);
+        cnt += 100000;
       } else {
-        if (cnt % 1000000 == 0) {
-          logger_->info(DRT, 19, "  Complete {} insts.", cnt);
-        }
+        logger_->info(DRT, 19, "  Complete {} insts.", cnt);
+        cnt += 1000000;
       }
     }
   }
-  cnt = 0;
+
+  int cnt = 0;
   for (auto& term : design_->getTopBlock()->getTerms()) {
     add(term.get(), allShapes);
     cnt++;
@@ -786,10 +894,12 @@ void frRegionQuery::Impl::init()
     }
   }
 
+  omp_set_num_threads(MAX_THREADS);
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < numLayers; i++) {
+    shapes_[i] = StaticRTree<frBlockObject*>(std::move(allShapes[i]));
+  }
   for (auto i = 0; i < numLayers; i++) {
-    shapes_.at(i) = boost::move(RTree<frBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
     if (VERBOSE > 0) {
       logger_->info(DRT,
                     24,
@@ -831,10 +941,8 @@ void frRegionQuery::Impl::initOrigGuide(
       }
     }
   }
+  bulkLoad(origGuides_, allShapes);
   for (auto i = 0; i < numLayers; i++) {
-    origGuides_.at(i) = boost::move(RTree<frNet*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
     if (VERBOSE > 0) {
       logger_->info(DRT,
                     28,
@@ -874,10 +982,8 @@ void frRegionQuery::Impl::initGuide()
       }
     }
   }
+  bulkLoad(guides_, allGuides);
   for (auto i = 0; i < numLayers; i++) {
-    guides_.at(i) = boost::move(RTree<frGuide*>(allGuides.at(i)));
-    allGuides.at(i).clear();
-    allGuides.at(i).shrink_to_fit();
     if (VERBOSE > 0) {
       logger_->info(DRT,
                     35,
@@ -925,11 +1031,7 @@ void frRegionQuery::Impl::initRPin()
     }
   }
 
-  for (auto i = 0; i < numLayers; i++) {
-    rpins_.at(i) = boost::move(RTree<frRPin*>(allRPins.at(i)));
-    allRPins.at(i).clear();
-    allRPins.at(i).shrink_to_fit();
-  }
+  bulkLoad(rpins_, allRPins);
 }
 
 void frRegionQuery::initDRObj()
@@ -958,11 +1060,7 @@ void frRegionQuery::Impl::initDRObj()
     }
   }
 
-  for (auto i = 0; i < numLayers; i++) {
-    drObjs_.at(i) = boost::move(RTree<frBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
-  }
+  bulkLoad(drObjs_, allShapes);
 }
 
 void frRegionQuery::Impl::initGRObj()
@@ -983,11 +1081,7 @@ void frRegionQuery::Impl::initGRObj()
     }
   }
 
-  for (auto i = 0; i < numLayers; i++) {
-    grObjs_.at(i) = boost::move(RTree<grBlockObject*>(allShapes.at(i)));
-    allShapes.at(i).clear();
-    allShapes.at(i).shrink_to_fit();
-  }
+  bulkLoad(grObjs_, allShapes);
 }
 
 void frRegionQuery::initGRObj()
@@ -1019,7 +1113,8 @@ void frRegionQuery::print()
                          33,
                          "{} shape region query size = {}.",
                          layerName,
-                         impl_->shapes_.at(i).size());
+                         impl_->shapes_.at(i).size()
+                             + impl_->addedShapes_.at(i).size());
   }
 }
 
@@ -69,6 +69,9 @@ bool ENABLE_VIA_GEN = true;
 bool CLEAN_PATCHES = false;
 bool DO_PA = true;
 bool SINGLE_STEP_DR = false;
+bool DR_DYNAMIC_SCHEDULING = false;
+bool TA_PANEL_COLORING = false;
+std::string PA_CACHE_FILE;
 bool SAVE_GUIDE_UPDATES = false;
 
 std::string VIAINPIN_BOTTOMLAYER_NAME;
@@ -72,6 +72,9 @@ extern bool ENABLE_VIA_GEN;
 extern bool CLEAN_PATCHES;
 extern bool DO_PA;
 extern bool SINGLE_STEP_DR;
+extern bool DR_DYNAMIC_SCHEDULING;
+extern bool TA_PANEL_COLORING;
+extern std::string PA_CACHE_FILE;
 extern bool SAVE_GUIDE_UPDATES;
 // extern int TEST;
 extern std::string VIAINPIN_BOTTOMLAYER_NAME;
@@ -28,6 +28,9 @@
 
 #include "io/io.h"
 
+#include <omp.h>
+
+#include <chrono>
 #include <exception>
 #include <fstream>
 #include <iostream>
@@ -42,6 +45,7 @@
 #include "odb/dbWireCodec.h"
 #include "triton_route/TritonRoute.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace drt {
 
@@ -118,6 +122,11 @@ void io::Parser::setTracks(odb::dbBlock* block)
 }
 
 void io::Parser::setInst(odb::dbInst* inst)
+{
+  getBlock()->addInst(makeInst(inst));
+}
+
+std::unique_ptr<frInst> io::Parser::makeInst(odb::dbInst* inst) const
 {
   frMaster* master = design_->name2master_.at(inst->getMaster()->getName());
   auto uInst = std::make_unique<frInst>(inst->getName(), master);
@@ -144,22 +153,43 @@ void io::Parser::setInst(odb::dbInst* inst)
         = std::make_unique<frInstBlockage>(tmpInst, blk);
     tmpInst->addInstBlockage(std::move(instBlk));
   }
-  getBlock()->addInst(std::move(uInst));
+  return uInst;
 }
 
 void io::Parser::setInsts(odb::dbBlock* block)
 {
+  std::vector<odb::dbInst*> db_insts;
+  db_insts.reserve(block->getInsts().size());
   for (auto inst : block->getInsts()) {
     if (design_->name2master_.find(inst->getMaster()->getName())
         == design_->name2master_.end()) {
       logger_->error(
           DRT, 95, "Library cell {} not found.", inst->getMaster()->getName());
     }
+    db_insts.push_back(inst);
+  }
+
+  // Instances are built concurrently and added in odb order so ids stay
+  // deterministic.
+  std::vector<std::unique_ptr<frInst>> insts(db_insts.size());
+  omp_set_num_threads(MAX_THREADS);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (int i = 0; i < (int) db_insts.size(); i++) {
+    try {
+      insts[i] = makeInst(db_insts[i]);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+
+  for (auto& inst : insts) {
     if (getBlock()->name2inst_.find(inst->getName())
         != getBlock()->name2inst_.end()) {
       logger_->error(DRT, 96, "Same cell name: {}.", inst->getName());
     }
-    setInst(inst);
+    getBlock()->addInst(std::move(inst));
   }
 }
 
@@ -173,27 +203,28 @@ void io::Parser::setObstructions(odb::dbBlock* block)
       continue;
     }
     frLayerNum layerNum = tech_->name2layer_[layerName]->getLayerNum();
-    auto blkIn = std::make_unique<frBlockage>();
-    auto pinIn = std::make_unique<frBPin>();
-    pinIn->setId(0);
-    frCoord xl = blockage->getBBox()->xMin();
-    frCoord yl = blockage->getBBox()->yMin();
-    frCoord xh = blockage->getBBox()->xMax();
-    frCoord yh = blockage->getBBox()->yMax();
-    // pinFig
-    std::unique_ptr<frRect> pinFig = std::make_unique<frRect>();
-    pinFig->setBBox(Rect(xl, yl, xh, yh));
-    pinFig->addToPin(pinIn.get());
-    pinFig->setLayerNum(layerNum);
-    // pinFig completed
-    std::unique_ptr<frPinFig> uptr(std::move(pinFig));
-    pinIn->addPinFig(std::move(uptr));
-
-    blkIn->setPin(std::move(pinIn));
-    getBlock()->addBlockage(std::move(blkIn));
+    addObstruction(layerNum, blockage->getBBox()->getBox());
   }
 }
 
+void io::Parser::addObstruction(frLayerNum layerNum, const Rect& box)
+{
+  auto blkIn = std::make_unique<frBlockage>();
+  auto pinIn = std::make_unique<frBPin>();
+  pinIn->setId(0);
+  // pinFig
+  std::unique_ptr<frRect> pinFig = std::make_unique<frRect>();
+  pinFig->setBBox(box);
+  pinFig->addToPin(pinIn.get());
+  pinFig->setLayerNum(layerNum);
+  // pinFig completed
+  std::unique_ptr<frPinFig> uptr(std::move(pinFig));
+  pinIn->addPinFig(std::move(uptr));
+
+  blkIn->setPin(std::move(pinIn));
+  getBlock()->addBlockage(std::move(blkIn));
+}
+
 void io::Parser::setVias(odb::dbBlock* block)
 {
   for (auto via : block->getVias()) {
@@ -553,11 +584,11 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
                      term->getName(),
                      term->getSigType().getString());
     }
-    if (getBlock()->name2term_.find(term->getName())
-        == getBlock()->name2term_.end()) {
+    auto term_it = getBlock()->name2term_.find(term->getName());
+    if (term_it == getBlock()->name2term_.end()) {
       logger_->error(DRT, 104, "Terminal {} not found.", term->getName());
     }
-    auto frbterm = getBlock()->name2term_[term->getName()];  // frBTerm*
+    auto frbterm = term_it->second;  // frBTerm*
     frbterm->addToNet(netIn);
     netIn->addBTerm(frbterm);
     if (!net->isSpecial()) {
@@ -579,12 +610,12 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
                      term->getName(),
                      term->getSigType().getString());
     }
-    if (getBlock()->name2inst_.find(term->getInst()->getName())
-        == getBlock()->name2inst_.end()) {
+    auto inst_it = getBlock()->name2inst_.find(term->getInst()->getName());
+    if (inst_it == getBlock()->name2inst_.end()) {
       logger_->error(
           DRT, 105, "Component {} not found.", term->getInst()->getName());
     }
-    auto inst = getBlock()->name2inst_[term->getInst()->getName()];
+    auto inst = inst_it->second;
     // gettin inst term
     auto frterm = inst->getMaster()->getTerm(term->getMTerm()->getName());
     if (frterm == nullptr) {
@@ -771,7 +802,8 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
           endpath = true;
         }
       } while (!endpath);
-      auto layerNum = tech_->name2layer_[layerName]->getLayerNum();
+      auto layer = tech_->getLayer(layerName);
+      auto layerNum = layer->getLayerNum();
       if (hasRect) {
         auto tmpPWire = std::make_unique<frPatchWire>();
         tmpPWire->setLayerNum(layerNum);
@@ -790,7 +822,6 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
         }
         tmpP->addToNet(netIn);
         tmpP->setLayerNum(layerNum);
-        auto layer = tech_->name2layer_[layerName];
         auto styleWidth = width;
         if (!(styleWidth)) {
           if ((layer->isHorizontal() && beginY != endY)
@@ -800,7 +831,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
             styleWidth = layer->getWidth();
           }
         }
-        width = (width) ? width : tech_->name2layer_[layerName]->getWidth();
+        width = (width) ? width : layer->getWidth();
         auto defaultBeginExt = width / 2;
         auto defaultEndExt = width / 2;
 
@@ -836,7 +867,8 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
         netIn->addShape(std::move(tmpP));
       }
       if (!viaName.empty()) {
-        if (tech_->name2via_.find(viaName) == tech_->name2via_.end()) {
+        auto via_it = tech_->name2via_.find(viaName);
+        if (via_it == tech_->name2via_.end()) {
           logger_->error(DRT, 108, "Unsupported via in db.");
         } else {
           Point p;
@@ -845,7 +877,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
           } else {
             p = {beginX, beginY};
           }
-          auto viaDef = tech_->name2via_[viaName];
+          auto viaDef = via_it->second;
           auto tmpP = std::make_unique<frVia>(viaDef);
           tmpP->setOrigin(p);
           tmpP->addToNet(netIn);
@@ -919,6 +951,7 @@ void io::Parser::updateNetRouting(frNet* netIn, odb::dbNet* net)
 }
 void io::Parser::setNets(odb::dbBlock* block)
 {
+  std::vector<std::pair<frNet*, odb::dbNet*>> nets;
   for (auto net : block->getNets()) {
     bool is_special = net->isSpecial();
     if (!is_special && net->getSigType().isSupply()) {
@@ -940,8 +973,11 @@ void io::Parser::setNets(odb::dbBlock* block)
     }
     if (is_special) {
       uNetIn->setIsSpecial(true);
+      // special wires resolve default widths through shared state
+      updateNetRouting(netIn, net);
+    } else {
+      nets.emplace_back(netIn, net);
     }
-    updateNetRouting(netIn, net);
     netIn->setType(net->getSigType());
     if (is_special) {
       getBlock()->addSNet(std::move(uNetIn));
@@ -949,6 +985,20 @@ void io::Parser::setNets(odb::dbBlock* block)
       getBlock()->addNet(std::move(uNetIn));
     }
   }
+
+  // Each signal net only touches its own terms and figures, so their wires
+  // are decoded concurrently.
+  omp_set_num_threads(MAX_THREADS);
+  utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic, 64)
+  for (int i = 0; i < (int) nets.size(); i++) {
+    try {
+      updateNetRouting(nets[i].first, nets[i].second);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
 }
 
 void updatefrAccessPoint(odb::dbAccessPoint* db_ap,
@@ -1222,6 +1272,7 @@ void io::Parser::readDesign(odb::dbDatabase* db)
   }
 
   ProfileTask profile("IO:readDesign");
+  const auto start = std::chrono::steady_clock::now();
   if (db->getChip() == nullptr) {
     logger_->error(DRT, 116, "Load design first.");
   }
@@ -1229,6 +1280,9 @@ void io::Parser::readDesign(odb::dbDatabase* db)
   if (block == nullptr) {
     logger_->error(DRT, 117, "Load design first.");
   }
+  // setInsts and setNets read odb from several threads; a lazily read db
+  // would stall all of them on the first access of each section
+  db->loadSections();
   auto tmpBlock = std::make_unique<frBlock>(std::string(block->getName()));
   design_->setTopBlock(std::move(tmpBlock));
   getBlock()->trackPatterns_.clear();
@@ -1242,6 +1296,15 @@ void io::Parser::readDesign(odb::dbDatabase* db)
   setNets(block);
   getBlock()->setId(0);
   addFakeNets();
+  if (VERBOSE > 1) {
+    const std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    logger_->info(DRT,
+                  625,
+                  "Read design from odb in {:.2f}s using {} threads.",
+                  elapsed.count(),
+                  MAX_THREADS);
+  }
 
   auto numLefVia = tech_->vias_.size();
   if (VERBOSE > 0) {
@@ -3045,6 +3108,165 @@ void io::Parser::updateDesign()
   design_->getRegionQuery()->initDRObj();
 }
 
+void io::Parser::updateNets(const std::set<odb::dbNet*>& nets,
+                            std::vector<Rect>& changedBoxes)
+{
+  auto regionQuery = design_->getRegionQuery();
+  auto removeRoutes = [&](frNet* net) {
+    for (auto& shape : net->getShapes()) {
+      changedBoxes.push_back(shape->getBBox());
+      regionQuery->removeDRObj(shape.get());
+    }
+    for (auto& via : net->getVias()) {
+      changedBoxes.push_back(via->getBBox());
+      regionQuery->removeDRObj(via.get());
+    }
+    for (auto& pwire : net->getPatchWires()) {
+      changedBoxes.push_back(pwire->getBBox());
+      regionQuery->removeDRObj(pwire.get());
+    }
+  };
+  auto addRoutes = [&](frNet* net) {
+    for (auto& shape : net->getShapes()) {
+      changedBoxes.push_back(shape->getBBox());
+      regionQuery->addDRObj(shape.get());
+    }
+    for (auto& via : net->getVias()) {
+      changedBoxes.push_back(via->getBBox());
+      regionQuery->addDRObj(via.get());
+    }
+    for (auto& pwire : net->getPatchWires()) {
+      changedBoxes.push_back(pwire->getBBox());
+      regionQuery->addDRObj(pwire.get());
+    }
+  };
+  for (auto db_net : nets) {
+    auto netIn = getBlock()->findNet(db_net->getName());
+    if (netIn == nullptr) {
+      continue;
+    }
+    removeRoutes(netIn);
+    // the fr routing is kept by updateNetRouting, so drop it to read
+    // the odb wire again
+    netIn->clearRoutes();
+    netIn->clearConns();
+    netIn->clearRPins();
+    netIn->clearGuides();
+    netIn->clearOrigGuides();
+    updateNetRouting(netIn, db_net);
+    addRoutes(netIn);
+  }
+}
+
+void io::Parser::updateSNets(const std::set<odb::dbNet*>& nets,
+                             std::vector<Rect>& changedBoxes)
+{
+  auto addBoxes = [&changedBoxes](frNet* net) {
+    for (auto& shape : net->getShapes()) {
+      changedBoxes.push_back(shape->getBBox());
+    }
+    for (auto& via : net->getVias()) {
+      changedBoxes.push_back(via->getBBox());
+    }
+  };
+  for (auto db_net : nets) {
+    auto netIn = getBlock()->findNet(db_net->getName());
+    if (netIn == nullptr) {
+      continue;
+    }
+    addBoxes(netIn);
+    netIn->clearRoutes();
+    netIn->clearConns();
+    updateNetRouting(netIn, db_net);
+    addBoxes(netIn);
+  }
+}
+
+void io::Parser::updateObstructions(odb::dbBlock* block,
+                                    std::vector<Rect>& changedBoxes)
+{
+  std::map<std::pair<frLayerNum, Rect>, int> obstructions;
+  for (auto blockage : block->getObstructions()) {
+    std::string layerName = blockage->getBBox()->getTechLayer()->getName();
+    auto layer_it = tech_->name2layer_.find(layerName);
+    if (layer_it == tech_->name2layer_.end()) {
+      continue;
+    }
+    obstructions[{layer_it->second->getLayerNum(),
+                  blockage->getBBox()->getBox()}]++;
+  }
+  std::vector<frBlockage*> removed;
+  for (auto& blk : getBlock()->getBlockages()) {
+    auto pinFig = static_cast<frRect*>(blk->getPin()->getFigs()[0].get());
+    auto it = obstructions.find({pinFig->getLayerNum(), pinFig->getBBox()});
+    if (it == obstructions.end() || it->second == 0) {
+      removed.push_back(blk.get());
+    } else {
+      it->second--;
+    }
+  }
+  for (auto blk : removed) {
+    changedBoxes.push_back(blk->getPin()->getFigs()[0]->getBBox());
+    getBlock()->removeBlockage(blk);
+  }
+  for (auto& [key, count] : obstructions) {
+    for (int i = 0; i < count; i++) {
+      addObstruction(key.first, key.second);
+      changedBoxes.push_back(key.second);
+    }
+  }
+}
+
+void io::Parser::reloadDesign(odb::dbDatabase* db,
+                              const std::set<odb::dbNet*>& changedNets)
+{
+  std::set<std::string> changedNames;
+  for (auto db_net : changedNets) {
+    changedNames.insert(db_net->getName());
+  }
+  // the pin access read from odb is owned by the masters and would be
+  // appended again by setAccessPoints
+  for (auto& master : design_->getMasters()) {
+    for (auto& term : master->getTerms()) {
+      for (auto& pin : term->getPins()) {
+        pin->clearPinAccess();
+      }
+    }
+  }
+  std::unique_ptr<frBlock> oldBlock = design_->releaseTopBlock();
+  readDesign(db);
+  for (auto& oldNet : oldBlock->getNets()) {
+    if (changedNames.find(oldNet->getName()) != changedNames.end()) {
+      continue;
+    }
+    auto netIn = getBlock()->findNet(oldNet->getName());
+    if (netIn == nullptr || !netIn->getShapes().empty()
+        || !netIn->getVias().empty() || !netIn->getPatchWires().empty()) {
+      continue;
+    }
+    for (auto& shape : oldNet->getShapes()) {
+      if (shape->typeId() == frcPathSeg) {
+        netIn->addShape(std::make_unique<frPathSeg>(
+            *static_cast<frPathSeg*>(shape.get())));
+      } else if (shape->typeId() == frcRect) {
+        netIn->addShape(
+            std::make_unique<frRect>(*static_cast<frRect*>(shape.get())));
+      }
+    }
+    for (auto& via : oldNet->getVias()) {
+      netIn->addVia(std::make_unique<frVia>(*via));
+    }
+    for (auto& pwire : oldNet->getPatchWires()) {
+      netIn->addPatchWire(std::make_unique<frPatchWire>(
+          *static_cast<frPatchWire*>(pwire.get())));
+    }
+  }
+  // nothing may point into the old block once it is gone
+  design_->getRegionQuery()->clearGuides();
+  design_->getRegionQuery()->init();
+  design_->getRegionQuery()->initDRObj();
+}
+
 frTechObject* io::Writer::getTech() const
 {
   return getDesign()->getTech();
@@ -31,6 +31,7 @@
 #include <boost/icl/interval_set.hpp>
 #include <list>
 #include <memory>
+#include <set>
 
 #include "frDesign.h"
 
@@ -81,6 +82,22 @@ class Parser
   }
   void buildGCellPatterns(odb::dbDatabase* db);
   void updateDesign();
+  // Re-read the routing of the given nets only. The boxes of their old
+  // and new shapes are appended to changedBoxes.
+  void updateNets(const std::set<odb::dbNet*>& nets,
+                  std::vector<Rect>& changedBoxes);
+  // Same as updateNets for special nets. The caller rebuilds the fixed
+  // shapes of the region query.
+  void updateSNets(const std::set<odb::dbNet*>& nets,
+                   std::vector<Rect>& changedBoxes);
+  // Sync the blockages with the odb obstructions. Unchanged blockages are
+  // kept; the boxes of added and removed ones are appended to changedBoxes.
+  void updateObstructions(odb::dbBlock* block, std::vector<Rect>& changedBoxes);
+  // Read the top block again, keeping the tech and libs. Routing that only
+  // lives in drt (the odb wires are dropped by initDesign) is carried over
+  // for nets that have no odb wire and are not in changedNets.
+  void reloadDesign(odb::dbDatabase* db,
+                    const std::set<odb::dbNet*>& changedNets);
 
  private:
   frBlock* getBlock() const { return design_->getTopBlock(); }
@@ -91,7 +108,9 @@ class Parser
   void setTracks(odb::dbBlock*);
   void setInsts(odb::dbBlock*);
   void setInst(odb::dbInst*);
+  std::unique_ptr<frInst> makeInst(odb::dbInst*) const;
   void setObstructions(odb::dbBlock*);
+  void addObstruction(frLayerNum layerNum, const Rect& box);
   void setBTerms(odb::dbBlock*);
   odb::Rect getViaBoxForTermAboveMaxLayer(odb::dbBTerm* term,
                                           frLayerNum& finalLayerNum);
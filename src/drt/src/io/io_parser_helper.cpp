@@ -810,9 +810,19 @@ void io::Parser::postProcess()
   convertLef58MinCutConstraints();
   // init region query
   logger_->info(DRT, 168, "Init region query.");
+  const auto start = std::chrono::steady_clock::now();
   design_->getRegionQuery()->init();
   design_->getRegionQuery()->print();
   design_->getRegionQuery()->initDRObj();  // second init from FlexDR.cpp
+  if (VERBOSE > 1) {
+    const std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    logger_->info(DRT,
+                  626,
+                  "Built region query in {:.2f}s using {} threads.",
+                  elapsed.count(),
+                  MAX_THREADS);
+  }
 }
 
 void io::Parser::postProcessGuide()
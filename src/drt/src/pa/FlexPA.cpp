@@ -95,6 +95,67 @@ void FlexPA::init()
   initSkipInstTerm();
 }
 
+void FlexPA::setCache(const std::string& file_name, odb::dbTech* tech)
+{
+  cache_ = std::make_unique<PinAccessCache>(design_, logger_);
+  cache_->read(file_name, tech);
+}
+
+void FlexPA::initCache()
+{
+  const auto& unique = unique_insts_.getUnique();
+  cache_keys_.assign(unique.size(), "");
+  cached_unique_.assign(unique.size(), false);
+  if (!cache_) {
+    return;
+  }
+  for (int i = 0; i < (int) unique.size(); i++) {
+    frInst* inst = unique[i];
+    // NDR instances are their own class and depend on their nets
+    if (unique_insts_.getClass(inst) == nullptr) {
+      continue;
+    }
+    std::vector<bool> skip_terms;
+    for (auto& instTerm : inst->getInstTerms()) {
+      skip_terms.push_back(isSkipInstTerm(instTerm.get()));
+    }
+    cache_keys_[i] = cache_->getKey(inst, skip_terms);
+    cached_unique_[i] = cache_->hasEntry(cache_keys_[i]);
+  }
+}
+
+// Cache entries are origin relative, so this must run after
+// revertAccessPoints.
+void FlexPA::updateCache()
+{
+  if (!cache_) {
+    return;
+  }
+  const auto& unique = unique_insts_.getUnique();
+  int num_cached = 0;
+  for (int i = 0; i < (int) unique.size(); i++) {
+    if (cached_unique_[i]) {
+      cache_->restore(
+          cache_keys_[i], unique[i], unique_insts_.getPAIndex(unique[i]));
+      num_cached++;
+    } else if (!cache_keys_[i].empty()) {
+      cache_->save(
+          cache_keys_[i], unique[i], unique_insts_.getPAIndex(unique[i]));
+    }
+  }
+  if (VERBOSE > 0) {
+    logger_->info(DRT,
+                  631,
+                  "Reused access points of {} of {} unique instances from "
+                  "the pin access cache.",
+                  num_cached,
+                  unique.size());
+  }
+  if (cache_->isDirty()) {
+    cache_->write();
+  }
+}
+
 void FlexPA::applyPatternsFile(const char* file_path)
 {
   uniqueInstPatterns_.clear();
@@ -109,8 +170,10 @@ void FlexPA::applyPatternsFile(const char* file_path)
 void FlexPA::prep()
 {
   ProfileTask profile("PA:prep");
+  initCache();
   prepPoint();
   revertAccessPoints();
+  updateCache();
   if (isDistributed()) {
     std::vector<paUpdate> updates;
     paUpdate update;
@@ -31,12 +31,14 @@
 #include <boost/polygon/polygon.hpp>
 #include <cstdint>
 
+#include "FlexPA_cache.h"
 #include "FlexPA_unique.h"
 #include "frDesign.h"
 namespace gtl = boost::polygon;
 
 namespace odb {
 class dbDatabase;
+class dbTech;
 }
 
 namespace dst {
@@ -75,6 +77,8 @@ class FlexPA
                       uint16_t rport,
                       const std::string& shared_vol,
                       int cloud_sz);
+  // Reuse and record unique instance access points in file_name
+  void setCache(const std::string& file_name, odb::dbTech* tech);
 
   int main();
 
@@ -99,6 +103,10 @@ class FlexPA
       uniqueInstPatterns_;
 
   UniqueInsts unique_insts_;
+  std::unique_ptr<PinAccessCache> cache_;
+  // per unique instance: cache key and whether it was restored from cache_
+  std::vector<std::string> cache_keys_;
+  std::vector<bool> cached_unique_;
   using UniqueMTerm = std::pair<const UniqueInsts::InstSet*, frMTerm*>;
   std::map<UniqueMTerm, bool> skip_unique_inst_term_;
 
@@ -134,6 +142,8 @@ class FlexPA
   void initSkipInstTerm();
   // prep
   void prep();
+  void initCache();
+  void updateCache();
   void prepPoint();
   void getViasFromMetalWidthMap(
       const Point& pt,
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "FlexPA_cache.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "distributed/frArchive.h"
+#include "odb/db.h"
+#include "odb/lefout.h"
+
+namespace drt {
+
+// Bump when the entry layout or the key changes.
+static constexpr int cache_version = 1;
+
+// FNV-1a, so that hashes are stable across builds and platforms.
+static uint64_t hashString(const std::string& str)
+{
+  uint64_t hash = 14695981039346656037ULL;
+  for (const char c : str) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+PinAccessCache::PinAccessCache(frDesign* design, Logger* logger)
+    : design_(design), logger_(logger)
+{
+}
+
+uint64_t PinAccessCache::hashRules(odb::dbTech* tech) const
+{
+  std::ostringstream rules;
+  odb::lefout writer(logger_, rules);
+  writer.writeTech(tech);
+
+  // Settings that change which access points are generated.
+  rules << DBPROCESSNODE << '|' << BOTTOM_ROUTING_LAYER << '|'
+        << TOP_ROUTING_LAYER << '|' << VIAINPIN_BOTTOMLAYERNUM << '|'
+        << VIAINPIN_TOPLAYERNUM << '|' << MINNUMACCESSPOINT_STDCELLPIN << '|'
+        << MINNUMACCESSPOINT_MACROCELLPIN << '|' << USENONPREFTRACKS << '|'
+        << AUTO_TAPER_NDR_NETS << '|';
+  // Access points refer to vias by id, including the ones generated by drt.
+  // io::Writer::updateDbVias appends the generated vias to the block.  A later
+  // run reads them back at the same ids, after the DEF vias, and
+  // initDefaultVias then finds the identical via through
+  // frTechObject::addVia instead of adding it again, so this list is the
+  // same before and after the block is written.
+  for (const auto& via : design_->getTech()->getVias()) {
+    rules << via->getName() << ';';
+  }
+  return hashString(rules.str());
+}
+
+uint64_t PinAccessCache::hashMaster(frMaster* master)
+{
+  auto it = master_hashes_.find(master);
+  if (it != master_hashes_.end()) {
+    return it->second;
+  }
+
+  std::ostringstream geom;
+  auto addFigs = [&geom](const auto& figs) {
+    for (const auto& fig : figs) {
+      if (fig->typeId() == frcPolygon) {
+        auto polygon = static_cast<frPolygon*>(fig.get());
+        geom << 'P' << polygon->getLayerNum();
+        for (const Point& pt : polygon->getPoints()) {
+          geom << ' ' << pt.x() << ' ' << pt.y();
+        }
+      } else {
+        auto shape = static_cast<frShape*>(fig.get());
+        const Rect box = shape->getBBox();
+        geom << 'R' << shape->getLayerNum() << ' ' << box.xMin() << ' '
+             << box.yMin() << ' ' << box.xMax() << ' ' << box.yMax();
+      }
+      geom << ';';
+    }
+  };
+
+  const Rect die = master->getDieBox();
+  geom << master->getMasterType().getString() << ' ' << die.xMin() << ' '
+       << die.yMin() << ' ' << die.xMax() << ' ' << die.yMax() << '|';
+  for (const auto& term : master->getTerms()) {
+    geom << term->getName() << ':';
+    for (const auto& pin : term->getPins()) {
+      addFigs(pin->getFigs());
+      geom << '|';
+    }
+  }
+  for (const auto& blk : master->getBlockages()) {
+    addFigs(blk->getPin()->getFigs());
+  }
+
+  const uint64_t hash = hashString(geom.str());
+  master_hashes_[master] = hash;
+  return hash;
+}
+
+std::string PinAccessCache::getKey(frInst* inst,
+                                   const std::vector<bool>& skip_terms)
+{
+  frMaster* master = inst->getMaster();
+  std::string key = fmt::format("{}/{}/{:x}/",
+                                master->getName(),
+                                inst->getOrient().getString(),
+                                hashMaster(master));
+
+  // Offset of the instance origin to each track pattern it overlaps
+  const Point origin = inst->getOrigin();
+  const Rect box = inst->getBoundaryBBox();
+  for (frTrackPattern* tp : design_->getTopBlock()->getTrackPatterns()) {
+    const bool isVerticalTrack = tp->isHorizontal();
+    const frCoord spacing = tp->getTrackSpacing();
+    const frCoord low = tp->getStartCoord();
+    const frCoord high
+        = low + spacing * ((frCoord) std::max(1U, tp->getNumTracks()) - 1);
+    const frCoord boxLow = isVerticalTrack ? box.xMin() : box.yMin();
+    const frCoord boxHigh = isVerticalTrack ? box.xMax() : box.yMax();
+    if (spacing <= 0 || low > boxHigh || high < boxLow) {
+      key += "-,";
+      continue;
+    }
+    const frCoord coord = isVerticalTrack ? origin.x() : origin.y();
+    const frCoord offset = ((coord - low) % spacing + spacing) % spacing;
+    key += fmt::format("{}{}{}:{},",
+                       tp->getLayerNum(),
+                       isVerticalTrack ? 'V' : 'H',
+                       spacing,
+                       offset);
+  }
+
+  key += '/';
+  for (const bool skip : skip_terms) {
+    key += skip ? '1' : '0';
+  }
+  return key;
+}
+
+void PinAccessCache::restore(const std::string& key,
+                             frInst* inst,
+                             int pa_idx) const
+{
+  // The key hashes the master's pins, so the entry has one list per pin.
+  const Entry& entry = entries_.at(key);
+  size_t idx = 0;
+  for (auto& instTerm : inst->getInstTerms()) {
+    for (auto& pin : instTerm->getTerm()->getPins()) {
+      auto pinAccess = pin->getPinAccess(pa_idx);
+      for (const auto& ap : entry[idx]) {
+        pinAccess->addAccessPoint(std::make_unique<frAccessPoint>(*ap));
+      }
+      idx++;
+    }
+  }
+}
+
+void PinAccessCache::save(const std::string& key, frInst* inst, int pa_idx)
+{
+  Entry entry;
+  for (auto& instTerm : inst->getInstTerms()) {
+    for (auto& pin : instTerm->getTerm()->getPins()) {
+      PinAccessPoints aps;
+      for (const auto& ap : pin->getPinAccess(pa_idx)->getAccessPoints()) {
+        aps.push_back(std::make_unique<frAccessPoint>(*ap));
+      }
+      entry.push_back(std::move(aps));
+    }
+  }
+  entries_[key] = std::move(entry);
+  dirty_ = true;
+}
+
+void PinAccessCache::read(const std::string& file_name, odb::dbTech* tech)
+{
+  file_name_ = file_name;
+  rules_hash_ = hashRules(tech);
+  entries_.clear();
+
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file.good()) {
+    return;
+  }
+  try {
+    frIArchive ar(file);
+    ar.setDesign(design_);
+    registerTypes(ar);
+    int version = 0;
+    uint64_t rules_hash = 0;
+    ar >> version;
+    ar >> rules_hash;
+    if (version != cache_version || rules_hash != rules_hash_) {
+      logger_->info(DRT,
+                    627,
+                    "Pin access cache {} was written under different rules; "
+                    "it will be rebuilt.",
+                    file_name);
+      return;
+    }
+    ar >> entries_;
+  } catch (const std::exception& e) {
+    entries_.clear();
+    logger_->warn(
+        DRT, 628, "Cannot read pin access cache {}: {}", file_name, e.what());
+    return;
+  }
+  logger_->info(DRT,
+                629,
+                "Read {} unique instances from pin access cache {}.",
+                entries_.size(),
+                file_name);
+}
+
+void PinAccessCache::write() const
+{
+  // Write next to the cache and rename it over the old file so that a
+  // crash or a concurrent run never leaves a truncated cache behind.
+  const std::string tmp_name
+      = file_name_ + ".tmp." + std::to_string(getpid());
+  std::ofstream file(tmp_name, std::ios::binary);
+  if (file.good()) {
+    frOArchive ar(file);
+    registerTypes(ar);
+    ar << cache_version;
+    ar << rules_hash_;
+    ar << entries_;
+  }
+  file.close();
+  if (file.fail() || std::rename(tmp_name.c_str(), file_name_.c_str()) != 0) {
+    std::remove(tmp_name.c_str());
+    logger_->warn(DRT, 630, "Cannot write pin access cache {}.", file_name_);
+  }
+}
+
+}  // namespace drt
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "frDesign.h"
+
+namespace odb {
+class dbTech;
+}
+
+namespace drt {
+
+// On-disk cache of the access points of unique instances.
+//
+// An entry is keyed by master, orientation, the offset of the instance
+// to every track pattern it overlaps and which of its terms are skipped.
+// The file records a hash of the technology and of the router settings
+// that affect pin access; a file written under other rules is ignored.
+// Access points are stored relative to the instance origin, as they are
+// after FlexPA::revertAccessPoints.
+class PinAccessCache
+{
+ public:
+  PinAccessCache(frDesign* design, Logger* logger);
+
+  // Loads the entries of file_name if it was written under the current
+  // rules.  A missing file starts an empty cache.
+  void read(const std::string& file_name, odb::dbTech* tech);
+  void write() const;
+
+  std::string getKey(frInst* inst, const std::vector<bool>& skip_terms);
+  bool hasEntry(const std::string& key) const
+  {
+    return entries_.find(key) != entries_.end();
+  }
+
+  // Copies the cached access points of key into inst's pins at pa_idx.
+  void restore(const std::string& key, frInst* inst, int pa_idx) const;
+  // Records the access points of inst's pins at pa_idx under key.
+  void save(const std::string& key, frInst* inst, int pa_idx);
+
+  bool isDirty() const { return dirty_; }
+  int getNumEntries() const { return entries_.size(); }
+
+ private:
+  using PinAccessPoints = std::vector<std::unique_ptr<frAccessPoint>>;
+  using Entry = std::vector<PinAccessPoints>;
+
+  uint64_t hashRules(odb::dbTech* tech) const;
+  uint64_t hashMaster(frMaster* master);
+
+  frDesign* design_;
+  Logger* logger_;
+  std::string file_name_;
+  uint64_t rules_hash_ = 0;
+  bool dirty_ = false;
+  std::map<frMaster*, uint64_t, frBlockObjectComp> master_hashes_;
+  std::map<std::string, Entry> entries_;
+};
+
+}  // namespace drt
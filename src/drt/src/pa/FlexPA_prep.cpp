@@ -1539,6 +1539,9 @@ void FlexPA::prepPoint()
   for (int i = 0; i < (int) unique.size(); i++) {  // NOLINT
     try {
       auto& inst = unique[i];
+      if (cached_unique_[i]) {
+        continue;
+      }
       // only do for core and block cells
       dbMasterType masterType = inst->getMaster()->getMasterType();
       if (masterType != dbMasterType::CORE
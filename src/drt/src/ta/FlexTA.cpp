@@ -119,7 +119,7 @@ int FlexTA::initTA_helper(int iter,
   auto& ygp = gCellPatterns.at(1);
   int sol = 0;
   numPanels = 0;
-  std::vector<std::vector<std::unique_ptr<FlexTAWorker>>> workers;
+  std::vector<std::unique_ptr<FlexTAWorker>> panels;
   if (isH) {
     for (int i = offset; i < (int) ygp.getCount(); i += size) {
       auto uworker
@@ -137,10 +137,7 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::HORIZONTAL);
       worker.setTAIter(iter);
-      if (workers.empty() || (int) workers.back().size() >= BATCHSIZETA) {
-        workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
-      }
-      workers.back().emplace_back(std::move(uworker));
+      panels.push_back(std::move(uworker));
     }
   } else {
     for (int i = offset; i < (int) xgp.getCount(); i += size) {
@@ -159,18 +156,40 @@ int FlexTA::initTA_helper(int iter,
       worker.setExtBox(extBox);
       worker.setDir(dbTechLayerDir::VERTICAL);
       worker.setTAIter(iter);
+      panels.push_back(std::move(uworker));
+    }
+  }
+
+  // Panels only read the design in main_mt and write it back in end().  A
+  // panel's extBox reaches half a gcell into its neighbours, so panels two
+  // apart never see each other.  With colouring, all even panels run in one
+  // pass on every thread and all odd panels in a second pass on top of the
+  // committed even ones, so the result does not depend on the thread count.
+  // Otherwise panels run in batches of BATCHSIZETA.
+  std::vector<std::vector<std::unique_ptr<FlexTAWorker>>> workers;
+  if (TA_PANEL_COLORING) {
+    workers.resize(std::min<int>(2, panels.size()));
+    for (int i = 0; i < (int) panels.size(); i++) {
+      workers[i % 2].push_back(std::move(panels[i]));
+    }
+    omp_set_num_threads(MAX_THREADS);
+  } else {
+    for (auto& panel : panels) {
       if (workers.empty() || (int) workers.back().size() >= BATCHSIZETA) {
         workers.emplace_back(std::vector<std::unique_ptr<FlexTAWorker>>());
       }
-      workers.back().push_back(std::move(uworker));
+      workers.back().push_back(std::move(panel));
     }
+    omp_set_num_threads(std::min(8, MAX_THREADS));
   }
+  panels.clear();
 
-  omp_set_num_threads(std::min(8, MAX_THREADS));
   // parallel execution
   // multi thread
-  for (auto& workerBatch : workers) {
+  for (int batch = 0; batch < (int) workers.size(); batch++) {
+    auto& workerBatch = workers[batch];
     ProfileTask profile("TA:batch");
+    const auto start = std::chrono::steady_clock::now();
     utl::ThreadException exception;
 #pragma omp parallel for schedule(dynamic)
     for (int i = 0; i < (int) workerBatch.size(); i++) {
@@ -189,6 +208,20 @@ int FlexTA::initTA_helper(int iter,
     for (auto& worker : workerBatch) {
       worker->end();
     }
+    if (TA_PANEL_COLORING && VERBOSE > 0) {
+      const std::chrono::duration<double> elapsed
+          = std::chrono::steady_clock::now() - start;
+      logger_->info(DRT,
+                    624,
+                    "TA iter {} {} colour {}: {} panels on {} threads in "
+                    "{:.2f}s.",
+                    iter,
+                    isH ? "horizontal" : "vertical",
+                    batch,
+                    workerBatch.size(),
+                    std::min<int>(MAX_THREADS, workerBatch.size()),
+                    elapsed.count());
+    }
     workerBatch.clear();
   }
   return sol;
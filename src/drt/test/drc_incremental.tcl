@@ -0,0 +1,49 @@
+# incremental check_drc after instance, obstruction and special wire edits
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def drc_test.def
+set incr_file [make_result_file drc_incremental.drc]
+set full_file [make_result_file drc_incremental_full.drc]
+drt::check_drc -incremental -output_file $incr_file
+
+set block [ord::get_db_block]
+set metal2 [[ord::get_db_tech] findLayer metal2]
+[$block findInst _508_] setLocation 116660 61600
+odb::dbObstruction_create $block $metal2 116000 62000 117000 63000
+set swire [lindex [[$block findNet VDD] getSWires] 0]
+odb::dbSBox_create $swire $metal2 110000 63500 120000 63640 STRIPE
+
+drt::check_drc -incremental -output_file $incr_file
+# a plain check ends the session, so the next one re-reads the block and
+# checks every tile
+drt::check_drc -output_file $full_file
+drt::check_drc -incremental -output_file $full_file
+
+# the tiles are reported in a different order than a full check
+proc read_violations { file } {
+  set stream [open $file r]
+  set violations {}
+  set violation ""
+  while { [gets $stream line] >= 0 } {
+    if { [string match "*violation type:*" $line] && $violation != "" } {
+      lappend violations $violation
+      set violation ""
+    }
+    append violation $line "\n"
+  }
+  if { $violation != "" } {
+    lappend violations $violation
+  }
+  close $stream
+  return [lsort $violations]
+}
+
+set incr [read_violations $incr_file]
+set full [read_violations $full_file]
+if { [llength $incr] == 0 || $incr != $full } {
+  puts "FAIL: incremental drc differs from full drc"
+  exit 1
+}
+puts "pass"
+exit
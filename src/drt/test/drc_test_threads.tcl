@@ -0,0 +1,37 @@
+# check_drc on a design imported with several threads must find the same
+# violations as drc_test.drcok, which comes from a serial import
+source "helpers.tcl"
+set_thread_count 4
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def drc_test.def
+set drc_file [make_result_file drc_test_threads.drc]
+drt::check_drc -output_file $drc_file
+
+# the threaded import may number objects differently, so compare as sets
+proc read_violations { file } {
+  set stream [open $file r]
+  set violations {}
+  set violation ""
+  while { [gets $stream line] >= 0 } {
+    if { [string match "*violation type:*" $line] && $violation != "" } {
+      lappend violations $violation
+      set violation ""
+    }
+    append violation $line "\n"
+  }
+  if { $violation != "" } {
+    lappend violations $violation
+  }
+  close $stream
+  return [lsort $violations]
+}
+
+set threaded [read_violations $drc_file]
+if { [llength $threaded] == 0
+     || $threaded != [read_violations drc_test.drcok] } {
+  puts "FAIL: threaded import drc differs from drc_test.drcok"
+  exit 1
+}
+puts "pass"
+exit
@@ -0,0 +1,20 @@
+# Workers scheduled by their neighbours must route the same as batches
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+set_thread_count 4
+detailed_route -output_drc results/dynamic_scheduling.output.drc.rpt \
+               -output_maze results/dynamic_scheduling.output.maze.log \
+               -verbose 0 \
+               -dynamic_scheduling
+
+set def_file [make_result_file dynamic_scheduling.def]
+write_def $def_file
+# ispd18_sample.defok is the result of the batch schedule
+if { [diff_files ispd18_sample.defok $def_file] } {
+  exit 1
+}
+puts "pass"
+exit
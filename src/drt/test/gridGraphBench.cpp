@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+// Microbenchmark of FlexGridGraph::search.  It builds a worker sized
+// two layer grid with random route shape costs and times searches between
+// random source and destination nodes.
+//
+// usage: drtGridGraphBench [num_searches] [num_tracks] [seed]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "db/drObj/drAccessPattern.h"
+#include "db/drObj/drPin.h"
+#include "dr/FlexDR.h"
+#include "dr/FlexGridGraph.h"
+#include "fixture.h"
+#include "rp/FlexRP.h"
+
+namespace drt {
+
+class GridGraphBench : public Fixture
+{
+ public:
+  GridGraphBench(int num_tracks, unsigned seed)
+      : worker_(&via_data_, design.get(), logger.get()),
+        graph_(design->getTech(), logger.get(), &worker_),
+        rng_(seed)
+  {
+    frTechObject* tech = design->getTech();
+    addLayer(tech, "v1", dbTechLayerType::CUT);
+    addLayer(tech, "m2", dbTechLayerType::ROUTING, dbTechLayerDir::VERTICAL);
+    makeSpacingConstraint(m1_);
+    makeSpacingConstraint(m2_);
+    FlexRP rp(design.get(), tech, logger.get());
+    rp.main();
+
+    const frCoord size = num_tracks * pitch_;
+    frBlock* block = design->getTopBlock();
+    frBoundary boundary;
+    boundary.setPoints({{0, 0}, {size, 0}, {size, size}, {0, size}});
+    block->setBoundaries({boundary});
+    block->addTrackPattern(std::make_unique<frTrackPattern>(
+        false, pitch_ / 2, num_tracks, pitch_, m1_));
+    block->addTrackPattern(std::make_unique<frTrackPattern>(
+        true, pitch_ / 2, num_tracks, pitch_, m2_));
+
+    const Rect box(0, 0, size, size);
+    worker_.setRouteBox(box);
+    worker_.setExtBox(box);
+    worker_.setDrcBox(box);
+    std::map<frCoord, std::map<frLayerNum, frTrackPattern*>> xMap;
+    std::map<frCoord, std::map<frLayerNum, frTrackPattern*>> yMap;
+    graph_.init(design.get(), box, box, xMap, yMap, true, false);
+    graph_.setCost(ROUTESHAPECOST, MARKERCOST, ROUTESHAPECOST);
+
+    // Existing routes block about a tenth of the nodes
+    frMIdx xDim, yDim, zDim;
+    graph_.getDim(xDim, yDim, zDim);
+    std::bernoulli_distribution blocked(0.1);
+    for (frMIdx z = 0; z < zDim; z++) {
+      for (frMIdx y = 0; y < yDim; y++) {
+        for (frMIdx x = 0; x < xDim; x++) {
+          if (blocked(rng_)) {
+            graph_.addRouteShapeCostPlanar(x, y, z);
+          }
+        }
+      }
+    }
+    x_dist_ = std::uniform_int_distribution<frMIdx>(0, xDim - 1);
+    y_dist_ = std::uniform_int_distribution<frMIdx>(0, yDim - 1);
+  }
+
+  // Returns the number of searches that found a path
+  int run(int num_searches)
+  {
+    int found = 0;
+    for (int i = 0; i < num_searches; i++) {
+      const FlexMazeIdx src(x_dist_(rng_), y_dist_(rng_), 0);
+      const FlexMazeIdx dst(x_dist_(rng_), y_dist_(rng_), 0);
+      drPin pin;
+      auto ap = std::make_unique<drAccessPattern>();
+      ap->setMazeIdx(dst);
+      pin.addAccessPattern(std::move(ap));
+
+      graph_.resetStatus();
+      graph_.setSrc(src);
+      graph_.setDst(dst);
+      std::vector<FlexMazeIdx> connComps{src};
+      std::vector<FlexMazeIdx> path;
+      FlexMazeIdx ccMazeIdx1 = src;
+      FlexMazeIdx ccMazeIdx2 = src;
+      std::map<FlexMazeIdx, frBox3D*> mazeIdx2TaperBox;
+      Point center;
+      graph_.getPoint(center, src.x(), src.y());
+      if (graph_.search(connComps,
+                        &pin,
+                        path,
+                        ccMazeIdx1,
+                        ccMazeIdx2,
+                        center,
+                        mazeIdx2TaperBox)) {
+        found++;
+      }
+    }
+    return found;
+  }
+
+ private:
+  static constexpr frLayerNum m1_ = 2;
+  static constexpr frLayerNum m2_ = 4;
+  static constexpr frCoord pitch_ = 200;
+
+  FlexDRViaData via_data_;
+  FlexDRWorker worker_;
+  FlexGridGraph graph_;
+  std::mt19937 rng_;
+  std::uniform_int_distribution<frMIdx> x_dist_;
+  std::uniform_int_distribution<frMIdx> y_dist_;
+};
+
+}  // namespace drt
+
+int main(int argc, char** argv)
+{
+  const int num_searches = argc > 1 ? std::atoi(argv[1]) : 1000;
+  const int num_tracks = argc > 2 ? std::atoi(argv[2]) : 200;
+  const unsigned seed = argc > 3 ? std::atoi(argv[3]) : 1;
+
+  drt::GridGraphBench bench(num_tracks, seed);
+  const auto start = std::chrono::steady_clock::now();
+  const int found = bench.run(num_searches);
+  const std::chrono::duration<double> elapsed
+      = std::chrono::steady_clock::now() - start;
+
+  std::cout << num_searches << " searches on a " << num_tracks << "x"
+            << num_tracks << " grid, " << found << " found a path\n"
+            << elapsed.count() << " s total, "
+            << elapsed.count() * 1e6 / num_searches << " us per search\n";
+  return 0;
+}
@@ -0,0 +1,46 @@
+# pin_access restores the same access points from its cache
+source "helpers.tcl"
+read_lef Nangate45/Nangate45_tech.lef
+read_lef Nangate45/Nangate45_stdcell.lef
+read_def drc_test.def
+
+proc access_points { block } {
+  set aps {}
+  foreach inst [$block getInsts] {
+    foreach iterm [$inst getITerms] {
+      foreach ap [$iterm getPrefAccessPoints] {
+        set pt [$ap getPoint]
+        lappend aps [list [$iterm getName] [$pt getX] [$pt getY] \
+                       [[$ap getLayer] getName]]
+      }
+    }
+  }
+  return $aps
+}
+
+set block [ord::get_db_block]
+set cache [make_result_file pa_cache.pa]
+file delete $cache
+
+pin_access -pin_access_cache $cache
+set computed [access_points $block]
+if { ![file exists $cache] || [glob -nocomplain $cache.tmp.*] != {} } {
+  puts "FAIL: cache not written"
+  exit 1
+}
+
+# Every unique instance is cached, so the second run must not add to the
+# cache and rewrite it.
+file mtime $cache 1000000000
+pin_access -pin_access_cache $cache
+set restored [access_points $block]
+if { [file mtime $cache] != 1000000000 } {
+  puts "FAIL: cache rewritten"
+  exit 1
+}
+if { [llength $computed] == 0 || $computed != $restored } {
+  puts "FAIL: restored access points differ"
+  exit 1
+}
+puts "pass"
+exit
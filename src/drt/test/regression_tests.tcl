@@ -15,4 +15,9 @@ record_tests {
 }
 record_pass_fail_tests {
   gc_test
+  drc_incremental
+  pa_cache
+  dynamic_scheduling
+  ta_panel_coloring
+  drc_test_threads
 }
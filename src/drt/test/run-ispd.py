@@ -54,6 +54,11 @@ parser.add_argument(
                          'results'),
     help="Workspace directory to create the run scripts and save output files"
 )
+parser.add_argument(
+    "--ta-panel-coloring",
+    action="store_true",
+    help="Run track assignment with -ta_panel_coloring and report its scaling"
+)
 args = parser.parse_args()
 
 args.program = os.path.abspath(args.program)
@@ -75,6 +80,7 @@ def gen_files(work_dir, ispd_year, design, drv_min, drv_max):
     # TritonRoute setup
     verbose = 1
     threads = multiprocessing.cpu_count()
+    ta_flags = "-ta_panel_coloring" if args.ta_panel_coloring else ""
 
     design_dir = os.path.join(work_dir, design)
     os.makedirs(design_dir, exist_ok=True)
@@ -87,7 +93,7 @@ def gen_files(work_dir, ispd_year, design, drv_min, drv_max):
             read_guides {bench_dir}/{design}/{design}.input.guide 
             detailed_route -output_maze {design_dir}/{design}.output.maze.log \\
                            -output_drc {design_dir}/{design}.output.drc.rpt \\
-                           -verbose {verbose}
+                           -verbose {verbose} {ta_flags}
             write_def {design_dir}/{design}.output.def
             set drv_count [detailed_route_num_drvs]
             if {{ $drv_count > {drv_max} }} {{
@@ -182,6 +188,18 @@ for design_name in running_tests:
                     f"{args.workspace}/{design_name}"],
                    check=True)
 
+if args.ta_panel_coloring:
+    print("TA scaling")
+    for design_name in sorted(running_tests):
+        log = os.path.join(args.workspace, design_name,
+                           f"run_{design_name}.log")
+        if not os.path.isfile(log):
+            continue
+        with open(log) as log_file:
+            for line in log_file:
+                if "DRT-0624" in line:
+                    print(f"{design_name}: {line.strip()}")
+
 print("=======================")
 if status.returncode:
     print("Fail")
@@ -0,0 +1,25 @@
+# detailed_route with track assignment panels scheduled by colour
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+set_thread_count 4
+detailed_route -output_drc results/ta_panel_coloring.output.drc.rpt \
+               -output_maze results/ta_panel_coloring.output.maze.log \
+               -verbose 1 \
+               -ta_panel_coloring
+
+set drvs [detailed_route_num_drvs]
+if { $drvs != 0 } {
+  puts "FAIL: $drvs violations"
+  exit 1
+}
+foreach net [[ord::get_db_block] getNets] {
+  if { [llength [$net getGuides]] > 0 && [$net getWire] == "NULL" } {
+    puts "FAIL: [$net getName] is not routed"
+    exit 1
+  }
+}
+puts "pass"
+exit
@@ -101,6 +101,7 @@ class Replace
 
   void setTargetDensity(float density);
   void setUniformTargetDensityMode(bool mode);
+  void setIncrementalDensityMode(bool mode);
   void setTargetOverflow(float overflow);
   void setInitDensityPenalityFactor(float penaltyFactor);
   void setInitWireLengthCoef(float coef);
@@ -122,6 +123,7 @@ class Replace
   void setSkipIoMode(bool mode);
 
   void setRoutabilityDrivenMode(bool mode);
+  void setRoutabilityUseRudy(bool mode);
   void setRoutabilityCheckOverflow(float overflow);
   void setRoutabilityMaxDensity(float density);
 
@@ -136,6 +138,7 @@ class Replace
 
   void addTimingNetWeightOverflow(int overflow);
   void setTimingNetWeightMax(float max);
+  void setTimingDrivenIncrementalMode(bool mode);
 
   void setDebug(int pause_iterations,
                 int update_iterations,
@@ -200,8 +203,11 @@ class Replace
   float timingNetWeightMax_ = 1.9;
 
   bool timingDrivenMode_ = true;
+  bool timingDrivenIncrementalMode_ = false;
   bool routabilityDrivenMode_ = true;
+  bool routabilityUseRudy_ = false;
   bool uniformTargetDensityMode_ = false;
+  bool incrementalDensityMode_ = false;
   bool skipIoMode_ = false;
 
   std::vector<int> timingNetWeightOverflows_;
@@ -33,6 +33,9 @@
 
 #include "fft.h"
 
+#include <omp.h>
+
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
@@ -42,37 +45,44 @@
 
 namespace gpl {
 
-FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
+FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY, int num_threads)
     : binCntX_(binCntX),
       binCntY_(binCntY),
       binSizeX_(binSizeX),
-      binSizeY_(binSizeY)
+      binSizeY_(binSizeY),
+      num_threads_(std::max(num_threads, 1))
 {
-  binDensity_ = new float*[binCntX_];
-  electroPhi_ = new float*[binCntX_];
-  electroForceX_ = new float*[binCntX_];
-  electroForceY_ = new float*[binCntX_];
-
-  for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i] = new float[binCntY_];
-    electroPhi_[i] = new float[binCntY_];
-    electroForceX_[i] = new float[binCntY_];
-    electroForceY_[i] = new float[binCntY_];
-
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] = electroPhi_[i][j] = electroForceX_[i][j]
-          = electroForceY_[i][j] = 0.0f;
-    }
-  }
+  const int binCnt = binCntX_ * binCntY_;
+  binDensity_.resize(binCnt, 0);
+  electroPhi_.resize(binCnt, 0);
+  electroForceX_.resize(binCnt, 0);
+  electroForceY_.resize(binCnt, 0);
 
-  csTable_.resize(std::max(binCntX_, binCntY_) * 3 / 2, 0);
+  const int maxBinCnt = std::max(binCntX_, binCntY_);
+  csTable_.resize(maxBinCnt * 3 / 2, 0);
 
   wx_.resize(binCntX_, 0);
   wxSquare_.resize(binCntX_, 0);
   wy_.resize(binCntY_, 0);
   wySquare_.resize(binCntY_, 0);
 
-  workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
+  workArea_.resize(round(sqrt(maxBinCnt)) + 2, 0);
+
+  // Build the cos/sin tables up front, as ddct2d would on its first call,
+  // so the 1D transforms only read them and can run concurrently.
+  const int nw = maxBinCnt >> 2;
+  makewt(nw, workArea_.data(), csTable_.data());
+  if (maxBinCnt > workArea_[1]) {
+    makect(maxBinCnt, workArea_.data(), csTable_.data() + nw);
+  }
+
+  // The tables are rebuilt by any transform longer than 4 * nw.
+  if (maxBinCnt % 4 != 0) {
+    num_threads_ = 1;
+  }
+
+  // 4 columns are transformed at a time
+  colBuffers_.resize(num_threads_, std::vector<float>(4 * binCntX_, 0));
 
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
@@ -88,125 +98,96 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
   }
 }
 
-FFT::~FFT()
+void FFT::transform1d(Transform transform, int n, int isgn, float* data)
 {
-  using std::vector;
-  for (int i = 0; i < binCntX_; i++) {
-    delete[] binDensity_[i];
-    delete[] electroPhi_[i];
-    delete[] electroForceX_[i];
-    delete[] electroForceY_[i];
+  if (transform == Transform::Cosine) {
+    ddct(n, isgn, data, workArea_.data(), csTable_.data());
+  } else {
+    ddst(n, isgn, data, workArea_.data(), csTable_.data());
   }
-  delete[] binDensity_;
-  delete[] electroPhi_;
-  delete[] electroForceX_;
-  delete[] electroForceY_;
-
-  csTable_.clear();
-  wx_.clear();
-  wxSquare_.clear();
-  wy_.clear();
-  wySquare_.clear();
-
-  workArea_.clear();
 }
 
-void FFT::updateDensity(int x, int y, float density)
+// Same passes as ddxt2d_sub in fftsg2d.cpp so the results match the
+// single threaded Ooura 2D routines bit for bit.
+void FFT::transform2d(Transform rowTransform,
+                      Transform colTransform,
+                      int isgn,
+                      std::vector<float>& data)
 {
-  binDensity_[x][y] = density;
-}
+  const int n1 = binCntX_;
+  const int n2 = binCntY_;
 
-std::pair<float, float> FFT::getElectroForce(int x, int y) const
-{
-  return std::make_pair(electroForceX_[x][y], electroForceY_[x][y]);
-}
+#pragma omp parallel for num_threads(num_threads_)
+  for (int i = 0; i < n1; i++) {
+    transform1d(rowTransform, n2, isgn, &data[index(i, 0)]);
+  }
 
-float FFT::getElectroPhi(int x, int y) const
-{
-  return electroPhi_[x][y];
+  if (n2 < 2) {
+    return;
+  }
+
+  const int width = n2 > 2 ? 4 : 2;
+#pragma omp parallel for num_threads(num_threads_)
+  for (int j = 0; j < n2; j += width) {
+    float* t = colBuffers_[omp_get_thread_num()].data();
+    for (int i = 0; i < n1; i++) {
+      for (int k = 0; k < width; k++) {
+        t[k * n1 + i] = data[index(i, j + k)];
+      }
+    }
+    for (int k = 0; k < width; k++) {
+      transform1d(colTransform, n1, isgn, &t[k * n1]);
+    }
+    for (int i = 0; i < n1; i++) {
+      for (int k = 0; k < width; k++) {
+        data[index(i, j + k)] = t[k * n1 + i];
+      }
+    }
+  }
 }
 
 void FFT::doFFT()
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-
-  for (int i = 0; i < binCntX_; i++) {
-    binDensity_[i][0] *= 0.5;
-  }
+  transform2d(Transform::Cosine, Transform::Cosine, -1, binDensity_);
 
-  for (int i = 0; i < binCntY_; i++) {
-    binDensity_[0][i] *= 0.5;
-  }
+  // The first row and column are halved before the whole grid is scaled
+  // by 4 / binCnt.  Halving is exact, so it is folded into the scale.
+  const double scale = 4.0 / binCntX_ / binCntY_;
 
+#pragma omp parallel for num_threads(num_threads_)
   for (int i = 0; i < binCntX_; i++) {
-    for (int j = 0; j < binCntY_; j++) {
-      binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
+    const float wx2 = wxSquare_[i];
+    const float wx = wx_[i];
+    const double rowScale = (i == 0) ? scale * 0.5 : scale;
+    const float* density = &binDensity_[index(i, 0)];
+    float* phi = &electroPhi_[index(i, 0)];
+    float* electroX = &electroForceX_[index(i, 0)];
+    float* electroY = &electroForceY_[index(i, 0)];
+
+    // j == 0 takes the extra half; (0, 0) is the DC term and carries no
+    // potential.
+    if (i == 0) {
+      phi[0] = electroX[0] = electroY[0] = 0.0f;
+    } else {
+      const float d = density[0] * (rowScale * 0.5);
+      phi[0] = d / (wx2 + wySquare_[0]);
+      electroX[0] = phi[0] * wx;
+      electroY[0] = phi[0] * wy_[0];
     }
-  }
 
-  for (int i = 0; i < binCntX_; i++) {
-    float wx = wx_[i];
-    float wx2 = wxSquare_[i];
-
-    for (int j = 0; j < binCntY_; j++) {
-      float wy = wy_[j];
-      float wy2 = wySquare_[j];
-
-      float density = binDensity_[i][j];
-      float phi = 0;
-      float electroX = 0, electroY = 0;
-
-      if (i == 0 && j == 0) {
-        phi = electroX = electroY = 0.0f;
-      } else {
-        //////////// lutong
-        //  denom =
-        //  wx2 / 4.0 +
-        //  wy2 / 4.0 ;
-        // a_phi = a_den / denom ;
-        ////b_phi = 0 ; // -1.0 * b / denom ;
-        ////a_ex = 0 ; // b_phi * wx ;
-        // a_ex = a_phi * wx / 2.0 ;
-        ////a_ey = 0 ; // b_phi * wy ;
-        // a_ey = a_phi * wy / 2.0 ;
-        ///////////
-        phi = density / (wx2 + wy2);
-        electroX = phi * wx;
-        electroY = phi * wy;
-      }
-      electroPhi_[i][j] = phi;
-      electroForceX_[i][j] = electroX;
-      electroForceY_[i][j] = electroY;
+    // branch free so the compiler can vectorize it
+    for (int j = 1; j < binCntY_; j++) {
+      const float d = density[j] * rowScale;
+      phi[j] = d / (wx2 + wySquare_[j]);
+      electroX[j] = phi[j] * wx;
+      electroY[j] = phi[j] * wy_[j];
     }
   }
+
   // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         nullptr,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          nullptr,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
+  transform2d(Transform::Cosine, Transform::Cosine, 1, electroPhi_);
+  transform2d(Transform::Cosine, Transform::Sine, 1, electroForceX_);
+  transform2d(Transform::Sine, Transform::Cosine, 1, electroForceY_);
 }
 
 }  // namespace gpl
@@ -33,6 +33,7 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 namespace gpl {
@@ -40,26 +41,54 @@ namespace gpl {
 class FFT
 {
  public:
-  FFT(int binCntX, int binCntY, int binSizeX, int binSizeY);
-  ~FFT();
+  FFT(int binCntX,
+      int binCntY,
+      int binSizeX,
+      int binSizeY,
+      int num_threads = 1);
 
   // input func
-  void updateDensity(int x, int y, float density);
+  void updateDensity(int x, int y, float density)
+  {
+    binDensity_[index(x, y)] = density;
+  }
 
   // do FFT
   void doFFT();
 
   // returning func
-  std::pair<float, float> getElectroForce(int x, int y) const;
-  float getElectroPhi(int x, int y) const;
+  std::pair<float, float> getElectroForce(int x, int y) const
+  {
+    return {electroForceX_[index(x, y)], electroForceY_[index(x, y)]};
+  }
+  float getElectroPhi(int x, int y) const { return electroPhi_[index(x, y)]; }
 
  private:
-  // 2D array; width: binCntX_, height: binCntY_;
-  // No hope to use Vector at this moment...
-  float** binDensity_ = nullptr;
-  float** electroPhi_ = nullptr;
-  float** electroForceX_ = nullptr;
-  float** electroForceY_ = nullptr;
+  // 1D transform applied to the rows or columns of a 2D transform
+  enum class Transform
+  {
+    Cosine,
+    Sine
+  };
+
+  int index(int x, int y) const { return x * binCntY_ + y; }
+
+  // 2D transform built from the 1D Ooura kernels.  Rows and column
+  // groups are independent and are split across num_threads_.
+  void transform2d(Transform rowTransform,
+                   Transform colTransform,
+                   int isgn,
+                   std::vector<float>& data);
+  void transform1d(Transform transform, int n, int isgn, float* data);
+
+  // 2D arrays stored x-major: width: binCntX_, height: binCntY_
+  std::vector<float> binDensity_;
+  std::vector<float> electroPhi_;
+  std::vector<float> electroForceX_;
+  std::vector<float> electroForceY_;
+
+  // per thread column buffers
+  std::vector<std::vector<float>> colBuffers_;
 
   // cos/sin table (prev: w_2d)
   // length:  max(binCntX, binCntY) * 3 / 2
@@ -81,6 +110,7 @@ class FFT
   int binCntY_ = 0;
   int binSizeX_ = 0;
   int binSizeY_ = 0;
+  int num_threads_ = 1;
 };
 
 //
@@ -92,6 +122,8 @@ class FFT
 void cdft(int n, int isgn, float* a, int* ip, float* w);
 void ddct(int n, int isgn, float* a, int* ip, float* w);
 void ddst(int n, int isgn, float* a, int* ip, float* w);
+void makewt(int nw, int* ip, float* w);
+void makect(int nc, int* ip, float* c);
 
 /// 2D FFT ////////////////////////////////////////////////////////////////
 void cdft2d(int, int, int, float**, float*, int*, float*);
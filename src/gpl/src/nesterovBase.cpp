@@ -75,6 +75,16 @@ static float getSecondNorm(const std::vector<FloatPoint>& a);
 //
 // Choose to use "float" only in the following functions
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell);
+static float getOverlapDensityArea(const Bin& bin,
+                                   int lx,
+                                   int ly,
+                                   int ux,
+                                   int uy);
+static std::pair<int, int> getDensityMinMaxIdx(int lower,
+                                               int upper,
+                                               int origin,
+                                               int binSize,
+                                               int binCnt);
 
 static float fastExp(float exp);
 
@@ -306,21 +316,6 @@ int64_t GNet::hpwl() const
   return (ux - lx) + (uy - ly);
 }
 
-void GNet::clearWaVars()
-{
-  waExpMinSumX_ = 0;
-  waXExpMinSumX_ = 0;
-
-  waExpMaxSumX_ = 0;
-  waXExpMaxSumX_ = 0;
-
-  waExpMinSumY_ = 0;
-  waYExpMinSumY_ = 0;
-
-  waExpMaxSumY_ = 0;
-  waYExpMaxSumY_ = 0;
-}
-
 void GNet::setDontCare()
 {
   isDontCare_ = true;
@@ -369,41 +364,6 @@ void GPin::setCenterLocation(int cx, int cy)
   cy_ = cy;
 }
 
-void GPin::clearWaVars()
-{
-  hasMaxExpSumX_ = false;
-  hasMaxExpSumY_ = false;
-  hasMinExpSumX_ = false;
-  hasMinExpSumY_ = false;
-
-  maxExpSumX_ = maxExpSumY_ = 0;
-  minExpSumX_ = minExpSumY_ = 0;
-}
-
-void GPin::setMaxExpSumX(float maxExpSumX)
-{
-  hasMaxExpSumX_ = true;
-  maxExpSumX_ = maxExpSumX;
-}
-
-void GPin::setMaxExpSumY(float maxExpSumY)
-{
-  hasMaxExpSumY_ = true;
-  maxExpSumY_ = maxExpSumY;
-}
-
-void GPin::setMinExpSumX(float minExpSumX)
-{
-  hasMinExpSumX_ = true;
-  minExpSumX_ = minExpSumX;
-}
-
-void GPin::setMinExpSumY(float minExpSumY)
-{
-  hasMinExpSumY_ = true;
-  minExpSumY_ = minExpSumY;
-}
-
 void GPin::updateLocation(const GCell* gCell)
 {
   cx_ = gCell->cx() + offsetCx_;
@@ -510,6 +470,14 @@ void BinGrid::setLogger(utl::Logger* log)
 void BinGrid::setTargetDensity(float density)
 {
   targetDensity_ = density;
+  // macro areas are scaled by the bin target density
+  densityBoxes_.clear();
+}
+
+void BinGrid::setIncrementalDensity(bool incremental)
+{
+  incrementalDensity_ = incremental;
+  densityBoxes_.clear();
 }
 
 void BinGrid::setBinCnt(int binCntX, int binCntY)
@@ -673,6 +641,7 @@ void BinGrid::initBins()
 
   // initialize bins_ vector
   bins_.resize(binCntX_ * (size_t) binCntY_);
+  densityBoxes_.clear();
 #pragma omp parallel for num_threads(num_threads_)
   for (int idxY = 0; idxY < binCntY_; ++idxY) {
     for (int idxX = 0; idxX < binCntX_; ++idxX) {
@@ -726,56 +695,192 @@ void BinGrid::updateBinsNonPlaceArea()
 // Core Part
 void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
 {
-  // clear the Bin-area info
+  bool rebuild = !incrementalDensity_ || densityBoxes_.size() != cells.size()
+                 || updatesSinceRebuild_ >= densityRebuildInterval_;
+
+  std::vector<int> changed;
+  if (!rebuild) {
+    const int cellCnt = cells.size();
+    for (int i = 0; i < cellCnt; i++) {
+      if (densityBoxes_[i].cell != cells[i]) {
+        rebuild = true;
+        break;
+      }
+      if (!sameDensityArea(densityBoxes_[i], densityBox(cells[i]))) {
+        changed.push_back(i);
+      }
+    }
+    // moving a cell is a removal plus an addition
+    if (changed.size() * 2 > cells.size()) {
+      rebuild = true;
+    }
+  }
+
+  if (rebuild) {
+    // clear the Bin-area info
+    for (Bin& bin : bins_) {
+      bin.setInstPlacedAreaUnscaled(0);
+      bin.setFillerArea(0);
+    }
+
+    densityBoxes_.clear();
+    for (auto& cell : cells) {
+      const DensityBox box = densityBox(cell);
+      addDensityArea(box, false);
+      if (incrementalDensity_) {
+        densityBoxes_.push_back(box);
+      }
+    }
+    updatesSinceRebuild_ = 0;
+  } else {
+    // The bin areas are integers, so removing the previous area of a
+    // cell is exact.
+    for (int i : changed) {
+      const DensityBox box = densityBox(cells[i]);
+      addDensityArea(densityBoxes_[i], true);
+      addDensityArea(box, false);
+      densityBoxes_[i] = box;
+    }
+    updatesSinceRebuild_++;
+    if (log_->debugCheck(GPL, "densityCheck", 1)) {
+      checkDensityArea(cells);
+    }
+  }
+
+  updateBinsDensity();
+}
+
+// Compare the incrementally updated bin areas against a full rebuild
+void BinGrid::checkDensityArea(const std::vector<GCell*>& cells)
+{
+  std::vector<std::pair<int64_t, int64_t>> incremental;
+  incremental.reserve(bins_.size());
   for (Bin& bin : bins_) {
+    incremental.emplace_back(bin.instPlacedAreaUnscaled(), bin.fillerArea());
     bin.setInstPlacedAreaUnscaled(0);
     bin.setFillerArea(0);
   }
-
   for (auto& cell : cells) {
-    std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
-    std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
+    addDensityArea(densityBox(cell), false);
+  }
+  for (size_t i = 0; i < bins_.size(); i++) {
+    const Bin& bin = bins_[i];
+    if (bin.instPlacedAreaUnscaled() != incremental[i].first
+        || bin.fillerArea() != incremental[i].second) {
+      log_->error(GPL,
+                  306,
+                  "Incremental density of bin ({}, {}) is {}/{} instead of "
+                  "{}/{}.",
+                  bin.x(),
+                  bin.y(),
+                  incremental[i].first,
+                  incremental[i].second,
+                  bin.instPlacedAreaUnscaled(),
+                  bin.fillerArea());
+    }
+  }
+}
 
-    // The following function is critical runtime hotspot
-    // for global placer.
-    //
-    if (cell->isInstance()) {
-      // macro should have
-      // scale-down with target-density
-      if (cell->isMacroInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-
-            const float scaledAvea = getOverlapDensityArea(bin, cell)
-                                     * cell->densityScale()
-                                     * bin.targetDensity();
-            bin.addInstPlacedAreaUnscaled(scaledAvea);
-          }
-        }
-      }
-      // normal cells
-      else if (cell->isStdInstance()) {
-        for (int y = pairY.first; y < pairY.second; y++) {
-          for (int x = pairX.first; x < pairX.second; x++) {
-            Bin& bin = bins_[y * binCntX_ + x];
-            const float scaledArea
-                = getOverlapDensityArea(bin, cell) * cell->densityScale();
-            bin.addInstPlacedAreaUnscaled(scaledArea);
-          }
+BinGrid::DensityBox BinGrid::densityBox(const GCell* cell)
+{
+  DensityBox box;
+  box.cell = cell;
+  box.lx = cell->dLx();
+  box.ly = cell->dLy();
+  box.ux = cell->dUx();
+  box.uy = cell->dUy();
+  box.scale = cell->densityScale();
+  return box;
+}
+
+void BinGrid::addDensityArea(const DensityBox& box, bool remove)
+{
+  const GCell* cell = box.cell;
+  const std::pair<int, int> pairX
+      = getDensityMinMaxIdx(box.lx, box.ux, lx(), binSizeX_, binCntX_);
+  const std::pair<int, int> pairY
+      = getDensityMinMaxIdx(box.ly, box.uy, ly(), binSizeY_, binCntY_);
+  const float scale = remove ? -box.scale : box.scale;
+
+  // The following function is critical runtime hotspot
+  // for global placer.
+  //
+  if (cell->isInstance()) {
+    // macro should have
+    // scale-down with target-density
+    if (cell->isMacroInstance()) {
+      for (int y = pairY.first; y < pairY.second; y++) {
+        for (int x = pairX.first; x < pairX.second; x++) {
+          Bin& bin = bins_[y * binCntX_ + x];
+
+          const float scaledAvea
+              = getOverlapDensityArea(bin, box.lx, box.ly, box.ux, box.uy)
+                * scale * bin.targetDensity();
+          bin.addInstPlacedAreaUnscaled(scaledAvea);
         }
       }
-    } else if (cell->isFiller()) {
+    }
+    // normal cells
+    else if (cell->isStdInstance()) {
       for (int y = pairY.first; y < pairY.second; y++) {
         for (int x = pairX.first; x < pairX.second; x++) {
           Bin& bin = bins_[y * binCntX_ + x];
-          bin.addFillerArea(getOverlapDensityArea(bin, cell)
-                            * cell->densityScale());
+          const float scaledArea
+              = getOverlapDensityArea(bin, box.lx, box.ly, box.ux, box.uy)
+                * scale;
+          bin.addInstPlacedAreaUnscaled(scaledArea);
         }
       }
     }
+  } else if (cell->isFiller()) {
+    for (int y = pairY.first; y < pairY.second; y++) {
+      for (int x = pairX.first; x < pairX.second; x++) {
+        Bin& bin = bins_[y * binCntX_ + x];
+        bin.addFillerArea(
+            getOverlapDensityArea(bin, box.lx, box.ly, box.ux, box.uy)
+            * scale);
+      }
+    }
+  }
+}
+
+// True if both boxes put the same area into the same bins
+bool BinGrid::sameDensityArea(const DensityBox& a, const DensityBox& b) const
+{
+  if (a.cell != b.cell || a.scale != b.scale) {
+    return false;
+  }
+  if (a.lx == b.lx && a.ly == b.ly && a.ux == b.ux && a.uy == b.uy) {
+    return true;
+  }
+  // a cell moving inside a single bin leaves its area unchanged
+  if (a.ux - a.lx != b.ux - b.lx || a.uy - a.ly != b.uy - b.ly) {
+    return false;
   }
+  const int bin = enclosingBin(a);
+  return bin >= 0 && bin == enclosingBin(b);
+}
 
+// Index of the bin containing the whole box, -1 if there is none
+int BinGrid::enclosingBin(const DensityBox& box) const
+{
+  if (box.lx < lx_ || box.ly < ly_) {
+    return -1;
+  }
+  const int x = (box.lx - lx_) / binSizeX_;
+  const int y = (box.ly - ly_) / binSizeY_;
+  if (x >= binCntX_ || y >= binCntY_) {
+    return -1;
+  }
+  const int idx = y * binCntX_ + x;
+  if (box.ux > bins_[idx].ux() || box.uy > bins_[idx].uy()) {
+    return -1;
+  }
+  return idx;
+}
+
+void BinGrid::updateBinsDensity()
+{
   overflowArea_ = 0;
   overflowAreaUnscaled_ = 0;
   // update density and overflowArea
@@ -810,24 +915,14 @@ void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
 
 std::pair<int, int> BinGrid::getDensityMinMaxIdxX(const GCell* gcell) const
 {
-  int lowerIdx = (gcell->dLx() - lx()) / binSizeX_;
-  int upperIdx = (fastModulo((gcell->dUx() - lx()), binSizeX_) == 0)
-                     ? (gcell->dUx() - lx()) / binSizeX_
-                     : (gcell->dUx() - lx()) / binSizeX_ + 1;
-
-  upperIdx = std::min(upperIdx, binCntX_);
-  return std::make_pair(lowerIdx, upperIdx);
+  return getDensityMinMaxIdx(
+      gcell->dLx(), gcell->dUx(), lx(), binSizeX_, binCntX_);
 }
 
 std::pair<int, int> BinGrid::getDensityMinMaxIdxY(const GCell* gcell) const
 {
-  int lowerIdx = (gcell->dLy() - ly()) / binSizeY_;
-  int upperIdx = (fastModulo((gcell->dUy() - ly()), binSizeY_) == 0)
-                     ? (gcell->dUy() - ly()) / binSizeY_
-                     : (gcell->dUy() - ly()) / binSizeY_ + 1;
-
-  upperIdx = std::min(upperIdx, binCntY_);
-  return std::make_pair(lowerIdx, upperIdx);
+  return getDensityMinMaxIdx(
+      gcell->dLy(), gcell->dUy(), ly(), binSizeY_, binCntY_);
 }
 
 std::pair<int, int> BinGrid::getMinMaxIdxX(const Instance* inst) const
@@ -960,6 +1055,30 @@ NesterovBaseCommon::NesterovBaseCommon(NesterovBaseVars nbVars,
       gNet.addGPin(pbToNb(pin));
     }
   }
+
+  // WA arrays: pins are given consecutive slots net by net
+  waSlots_.resize(gPinStor_.size(), -1);
+  const int netCnt = gNetStor_.size();
+  waNetStart_.reserve(netCnt + 1);
+  for (int net = 0; net < netCnt; net++) {
+    waNetStart_.push_back(waSlotPin_.size());
+    for (GPin* gPin : gNetStor_[net].gPins()) {
+      const int pin = gPin - &gPinStor_[0];
+      waSlots_[pin] = waSlotPin_.size();
+      waSlotPin_.push_back(pin);
+      waSlotNet_.push_back(net);
+    }
+  }
+  waNetStart_.push_back(waSlotPin_.size());
+
+  const int slotCnt = waSlotPin_.size();
+  waPinX_.resize(slotCnt, 0);
+  waPinY_.resize(slotCnt, 0);
+  waMinExpX_.resize(slotCnt, 0);
+  waMaxExpX_.resize(slotCnt, 0);
+  waMinExpY_.resize(slotCnt, 0);
+  waMaxExpY_.resize(slotCnt, 0);
+  waNetSums_.resize(gNetStor_.size());
 }
 
 GCell* NesterovBaseCommon::pbToNb(Instance* inst) const
@@ -1012,95 +1131,111 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
 void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
   assert(omp_get_thread_num() == 0);
-  // clear all WA variables.
+  const int slotCnt = waSlotPin_.size();
+  const int netCnt = gNetStor_.size();
+  const float forceBar = nbVars_.minWireLengthForceBar;
+
+  // gather pin locations
 #pragma omp parallel for num_threads(num_threads_)
-  for (auto gPin = gPinStor_.begin(); gPin < gPinStor_.end(); ++gPin) {
-    // old-style loop for old OpenMP
-    gPin->clearWaVars();
+  for (int slot = 0; slot < slotCnt; slot++) {
+    const GPin& gPin = gPinStor_[waSlotPin_[slot]];
+    waPinX_[slot] = gPin.cx();
+    waPinY_[slot] = gPin.cy();
   }
 
 #pragma omp parallel for num_threads(num_threads_)
-  for (auto gNet = gNetStor_.begin(); gNet < gNetStor_.end(); ++gNet) {
-    // old-style loop for old OpenMP
+  for (int net = 0; net < netCnt; net++) {
+    const int begin = waNetStart_[net];
+    const int end = waNetStart_[net + 1];
+
+    int lx = INT_MAX, ly = INT_MAX;
+    int ux = INT_MIN, uy = INT_MIN;
+    for (int slot = begin; slot < end; slot++) {
+      lx = std::min(waPinX_[slot], lx);
+      ly = std::min(waPinY_[slot], ly);
+      ux = std::max(waPinX_[slot], ux);
+      uy = std::max(waPinY_[slot], uy);
+    }
+    gNetStor_[net].setBox(lx, ly, ux, uy);
 
-    gNet->clearWaVars();
-    gNet->updateBox();
+    // The WA terms are shift invariant:
+    //
+    //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
+    //   -----------------    = -----------------
+    //   Sum(exp(x_i))          Sum(exp(x_i - C))
+    //
+    // So we shift to keep the exponential from overflowing.
+    // Kept branch free so the exponentials can be vectorized.
+    for (int slot = begin; slot < end; slot++) {
+      const float expMinX = (lx - waPinX_[slot]) * wlCoeffX;
+      const float expMaxX = (waPinX_[slot] - ux) * wlCoeffX;
+      const float expMinY = (ly - waPinY_[slot]) * wlCoeffY;
+      const float expMaxY = (waPinY_[slot] - uy) * wlCoeffY;
+
+      waMinExpX_[slot] = (expMinX > forceBar) ? fastExp(expMinX) : 0;
+      waMaxExpX_[slot] = (expMaxX > forceBar) ? fastExp(expMaxX) : 0;
+      waMinExpY_[slot] = (expMinY > forceBar) ? fastExp(expMinY) : 0;
+      waMaxExpY_[slot] = (expMaxY > forceBar) ? fastExp(expMaxY) : 0;
+    }
 
-    for (auto& gPin : gNet->gPins()) {
-      // The WA terms are shift invariant:
-      //
-      //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
-      //   -----------------    = -----------------
-      //   Sum(exp(x_i))          Sum(exp(x_i - C))
-      //
-      // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
-
-      // min x
-      if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumX());
-        }
-      }
+    WaNetSums sums;
+    for (int slot = begin; slot < end; slot++) {
+      sums.expMinSumX += waMinExpX_[slot];
+      sums.xExpMinSumX += waPinX_[slot] * waMinExpX_[slot];
+      sums.expMaxSumX += waMaxExpX_[slot];
+      sums.xExpMaxSumX += waPinX_[slot] * waMaxExpX_[slot];
+
+      sums.expMinSumY += waMinExpY_[slot];
+      sums.yExpMinSumY += waPinY_[slot] * waMinExpY_[slot];
+      sums.expMaxSumY += waMaxExpY_[slot];
+      sums.yExpMaxSumY += waPinY_[slot] * waMaxExpY_[slot];
+    }
+    waNetSums_[net] = sums;
+  }
 
-      // max x
-      if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumX());
-        }
+  // Only walk the slots when the debug output is enabled.
+  if (log_->debugCheck(GPL, "wlUpdateWA", 1)) {
+    for (int slot = 0; slot < slotCnt; slot++) {
+      const GPin& gPin = gPinStor_[waSlotPin_[slot]];
+      if (!gPin.gCell() || !gPin.gCell()->isInstance()) {
+        continue;
       }
-
-      // min y
-      if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumY());
-        }
+      const char* name = gPin.gCell()->instance()->dbInst()->getConstName();
+      if (waMinExpX_[slot] > 0) {
+        debugPrint(log_,
+                   GPL,
+                   "wlUpdateWA",
+                   1,
+                   "MinX updated: {} {:g}",
+                   name,
+                   waMinExpX_[slot]);
       }
-
-      // max y
-      if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumY());
-        }
+      if (waMaxExpX_[slot] > 0) {
+        debugPrint(log_,
+                   GPL,
+                   "wlUpdateWA",
+                   1,
+                   "MaxX updated: {} {:g}",
+                   name,
+                   waMaxExpX_[slot]);
+      }
+      if (waMinExpY_[slot] > 0) {
+        debugPrint(log_,
+                   GPL,
+                   "wlUpdateWA",
+                   1,
+                   "MinY updated: {} {:g}",
+                   name,
+                   waMinExpY_[slot]);
+      }
+      if (waMaxExpY_[slot] > 0) {
+        debugPrint(log_,
+                   GPL,
+                   "wlUpdateWA",
+                   1,
+                   "MaxY updated: {} {:g}",
+                   name,
+                   waMaxExpY_[slot]);
       }
     }
   }
@@ -1159,48 +1294,54 @@ FloatPoint NesterovBaseCommon::getWireLengthGradientPinWA(const GPin* gPin,
   float gradientMinX = 0, gradientMinY = 0;
   float gradientMaxX = 0, gradientMaxY = 0;
 
+  const int slot = waSlot(gPin);
+  if (slot < 0) {
+    return FloatPoint(0, 0);
+  }
+  const WaNetSums& sums = waNetSums_[waSlotNet_[slot]];
+
   // min x
-  if (gPin->hasMinExpSumX()) {
+  if (waMinExpX_[slot] > 0) {
     // from Net.
-    float waExpMinSumX = gPin->gNet()->waExpMinSumX();
-    float waXExpMinSumX = gPin->gNet()->waXExpMinSumX();
+    float waExpMinSumX = sums.expMinSumX;
+    float waXExpMinSumX = sums.xExpMinSumX;
 
     gradientMinX
-        = (waExpMinSumX * (gPin->minExpSumX() * (1.0 - wlCoeffX * gPin->cx()))
-           + wlCoeffX * gPin->minExpSumX() * waXExpMinSumX)
+        = (waExpMinSumX * (waMinExpX_[slot] * (1.0 - wlCoeffX * gPin->cx()))
+           + wlCoeffX * waMinExpX_[slot] * waXExpMinSumX)
           / (waExpMinSumX * waExpMinSumX);
   }
 
   // max x
-  if (gPin->hasMaxExpSumX()) {
-    float waExpMaxSumX = gPin->gNet()->waExpMaxSumX();
-    float waXExpMaxSumX = gPin->gNet()->waXExpMaxSumX();
+  if (waMaxExpX_[slot] > 0) {
+    float waExpMaxSumX = sums.expMaxSumX;
+    float waXExpMaxSumX = sums.xExpMaxSumX;
 
     gradientMaxX
-        = (waExpMaxSumX * (gPin->maxExpSumX() * (1.0 + wlCoeffX * gPin->cx()))
-           - wlCoeffX * gPin->maxExpSumX() * waXExpMaxSumX)
+        = (waExpMaxSumX * (waMaxExpX_[slot] * (1.0 + wlCoeffX * gPin->cx()))
+           - wlCoeffX * waMaxExpX_[slot] * waXExpMaxSumX)
           / (waExpMaxSumX * waExpMaxSumX);
   }
 
   // min y
-  if (gPin->hasMinExpSumY()) {
-    float waExpMinSumY = gPin->gNet()->waExpMinSumY();
-    float waYExpMinSumY = gPin->gNet()->waYExpMinSumY();
+  if (waMinExpY_[slot] > 0) {
+    float waExpMinSumY = sums.expMinSumY;
+    float waYExpMinSumY = sums.yExpMinSumY;
 
     gradientMinY
-        = (waExpMinSumY * (gPin->minExpSumY() * (1.0 - wlCoeffY * gPin->cy()))
-           + wlCoeffY * gPin->minExpSumY() * waYExpMinSumY)
+        = (waExpMinSumY * (waMinExpY_[slot] * (1.0 - wlCoeffY * gPin->cy()))
+           + wlCoeffY * waMinExpY_[slot] * waYExpMinSumY)
           / (waExpMinSumY * waExpMinSumY);
   }
 
   // max y
-  if (gPin->hasMaxExpSumY()) {
-    float waExpMaxSumY = gPin->gNet()->waExpMaxSumY();
-    float waYExpMaxSumY = gPin->gNet()->waYExpMaxSumY();
+  if (waMaxExpY_[slot] > 0) {
+    float waExpMaxSumY = sums.expMaxSumY;
+    float waYExpMaxSumY = sums.yExpMaxSumY;
 
     gradientMaxY
-        = (waExpMaxSumY * (gPin->maxExpSumY() * (1.0 + wlCoeffY * gPin->cy()))
-           - wlCoeffY * gPin->maxExpSumY() * waYExpMaxSumY)
+        = (waExpMaxSumY * (waMaxExpY_[slot] * (1.0 + wlCoeffY * gPin->cy()))
+           - wlCoeffY * waMaxExpY_[slot] * waYExpMaxSumY)
           / (waExpMaxSumY * waExpMaxSumY);
   }
 
@@ -1324,13 +1465,17 @@ NesterovBase::NesterovBase(NesterovBaseVars nbVars,
   bg_.setLogger(log_);
   bg_.setCorePoints(&(pb_->die()));
   bg_.setTargetDensity(targetDensity_);
+  bg_.setIncrementalDensity(nbVars_.useIncrementalDensity);
 
   // update binGrid info
   bg_.initBins();
 
   // initialize fft structrue based on bins
-  std::unique_ptr<FFT> fft(
-      new FFT(bg_.binCntX(), bg_.binCntY(), bg_.binSizeX(), bg_.binSizeY()));
+  std::unique_ptr<FFT> fft(new FFT(bg_.binCntX(),
+                                   bg_.binCntY(),
+                                   bg_.binSizeX(),
+                                   bg_.binSizeY(),
+                                   nbc_->getNumThreads()));
 
   fft_ = std::move(fft);
 
@@ -2367,10 +2512,20 @@ static int fastModulo(const int input, const int ceil)
 
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell)
 {
-  const int rectLx = std::max(bin.lx(), cell->dLx());
-  const int rectLy = std::max(bin.ly(), cell->dLy());
-  const int rectUx = std::min(bin.ux(), cell->dUx());
-  const int rectUy = std::min(bin.uy(), cell->dUy());
+  return getOverlapDensityArea(
+      bin, cell->dLx(), cell->dLy(), cell->dUx(), cell->dUy());
+}
+
+static float getOverlapDensityArea(const Bin& bin,
+                                   int lx,
+                                   int ly,
+                                   int ux,
+                                   int uy)
+{
+  const int rectLx = std::max(bin.lx(), lx);
+  const int rectLy = std::max(bin.ly(), ly);
+  const int rectUx = std::min(bin.ux(), ux);
+  const int rectUy = std::min(bin.uy(), uy);
 
   if (rectLx >= rectUx || rectLy >= rectUy) {
     return 0;
@@ -2379,6 +2534,21 @@ static float getOverlapDensityArea(const Bin& bin, const GCell* cell)
          * static_cast<float>(rectUy - rectLy);
 }
 
+static std::pair<int, int> getDensityMinMaxIdx(int lower,
+                                               int upper,
+                                               int origin,
+                                               int binSize,
+                                               int binCnt)
+{
+  int lowerIdx = (lower - origin) / binSize;
+  int upperIdx = (fastModulo((upper - origin), binSize) == 0)
+                     ? (upper - origin) / binSize
+                     : (upper - origin) / binSize + 1;
+
+  upperIdx = std::min(upperIdx, binCnt);
+  return std::make_pair(lowerIdx, upperIdx);
+}
+
 static int64_t getOverlapArea(const Bin* bin,
                               const Instance* inst,
                               int dbu_per_micron)
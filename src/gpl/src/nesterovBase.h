@@ -248,38 +248,12 @@ class GNet
 
   void addGPin(GPin* gPin);
   void updateBox();
+  void setBox(int lx, int ly, int ux, int uy);
   int64_t hpwl() const;
 
   void setDontCare();
   bool isDontCare() const;
 
-  // clear WA(Weighted Average) variables.
-  void clearWaVars();
-
-  void addWaExpMinSumX(float waExpMinSumX);
-  void addWaXExpMinSumX(float waXExpMinSumX);
-
-  void addWaExpMinSumY(float waExpMinSumY);
-  void addWaYExpMinSumY(float waYExpMinSumY);
-
-  void addWaExpMaxSumX(float waExpMaxSumX);
-  void addWaXExpMaxSumX(float waXExpMaxSumX);
-
-  void addWaExpMaxSumY(float waExpMaxSumY);
-  void addWaYExpMaxSumY(float waYExpMaxSumY);
-
-  float waExpMinSumX() const;
-  float waXExpMinSumX() const;
-
-  float waExpMinSumY() const;
-  float waYExpMinSumY() const;
-
-  float waExpMaxSumX() const;
-  float waXExpMaxSumX() const;
-
-  float waExpMaxSumY() const;
-  float waYExpMaxSumY() const;
-
  private:
   std::vector<GPin*> gPins_;
   std::vector<Net*> nets_;
@@ -291,43 +265,6 @@ class GNet
   float timingWeight_ = 1;
   float customWeight_ = 1;
 
-  //
-  // weighted average WL model stor for better indexing
-  // Please check the equation (4) in the ePlace-MS paper.
-  //
-  // WA: weighted Average
-  // saving four variable will be helpful for
-  // calculating the WA gradients/wirelengths.
-  //
-  // gamma: modeling accuracy.
-  //
-  // X forces.
-  //
-  // waExpMinSumX_: store sigma {exp(x_i/gamma)}
-  // waXExpMinSumX_: store signa {x_i*exp(e_i/gamma)}
-  // waExpMaxSumX_ : store sigma {exp(-x_i/gamma)}
-  // waXExpMaxSumX_: store sigma {x_i*exp(-x_i/gamma)}
-  //
-  float waExpMinSumX_ = 0;
-  float waXExpMinSumX_ = 0;
-
-  float waExpMaxSumX_ = 0;
-  float waXExpMaxSumX_ = 0;
-
-  //
-  // Y forces.
-  //
-  // waExpMinSumY_: store sigma {exp(y_i/gamma)}
-  // waYExpMinSumY_: store signa {y_i*exp(e_i/gamma)}
-  // waExpMaxSumY_ : store sigma {exp(-y_i/gamma)}
-  // waYExpMaxSumY_: store sigma {y_i*exp(-y_i/gamma)}
-  //
-  float waExpMinSumY_ = 0;
-  float waYExpMinSumY_ = 0;
-
-  float waExpMaxSumY_ = 0;
-  float waYExpMaxSumY_ = 0;
-
   bool isDontCare_ = false;
 };
 
@@ -351,85 +288,12 @@ inline int GNet::uy() const
   return uy_;
 }
 
-// eight add functions
-inline void GNet::addWaExpMinSumX(float waExpMinSumX)
-{
-  waExpMinSumX_ += waExpMinSumX;
-}
-
-inline void GNet::addWaXExpMinSumX(float waXExpMinSumX)
-{
-  waXExpMinSumX_ += waXExpMinSumX;
-}
-
-inline void GNet::addWaExpMinSumY(float waExpMinSumY)
-{
-  waExpMinSumY_ += waExpMinSumY;
-}
-
-inline void GNet::addWaYExpMinSumY(float waYExpMinSumY)
-{
-  waYExpMinSumY_ += waYExpMinSumY;
-}
-
-inline void GNet::addWaExpMaxSumX(float waExpMaxSumX)
-{
-  waExpMaxSumX_ += waExpMaxSumX;
-}
-
-inline void GNet::addWaXExpMaxSumX(float waXExpMaxSumX)
-{
-  waXExpMaxSumX_ += waXExpMaxSumX;
-}
-
-inline void GNet::addWaExpMaxSumY(float waExpMaxSumY)
-{
-  waExpMaxSumY_ += waExpMaxSumY;
-}
-
-inline void GNet::addWaYExpMaxSumY(float waYExpMaxSumY)
-{
-  waYExpMaxSumY_ += waYExpMaxSumY;
-}
-
-inline float GNet::waExpMinSumX() const
-{
-  return waExpMinSumX_;
-}
-
-inline float GNet::waXExpMinSumX() const
-{
-  return waXExpMinSumX_;
-}
-
-inline float GNet::waExpMinSumY() const
-{
-  return waExpMinSumY_;
-}
-
-inline float GNet::waYExpMinSumY() const
-{
-  return waYExpMinSumY_;
-}
-
-inline float GNet::waExpMaxSumX() const
-{
-  return waExpMaxSumX_;
-}
-
-inline float GNet::waXExpMaxSumX() const
-{
-  return waXExpMaxSumX_;
-}
-
-inline float GNet::waExpMaxSumY() const
-{
-  return waExpMaxSumY_;
-}
-
-inline float GNet::waYExpMaxSumY() const
+inline void GNet::setBox(int lx, int ly, int ux, int uy)
 {
-  return waYExpMaxSumY_;
+  lx_ = lx;
+  ly_ = ly;
+  ux_ = ux;
+  uy_ = uy;
 }
 
 class GPin
@@ -450,24 +314,6 @@ class GPin
   int cx() const { return cx_; }
   int cy() const { return cy_; }
 
-  // clear WA(Weighted Average) variables.
-  void clearWaVars();
-
-  void setMaxExpSumX(float maxExpSumX);
-  void setMaxExpSumY(float maxExpSumY);
-  void setMinExpSumX(float minExpSumX);
-  void setMinExpSumY(float minExpSumY);
-
-  float maxExpSumX() const { return maxExpSumX_; }
-  float maxExpSumY() const { return maxExpSumY_; }
-  float minExpSumX() const { return minExpSumX_; }
-  float minExpSumY() const { return minExpSumY_; }
-
-  bool hasMaxExpSumX() const { return hasMaxExpSumX_; }
-  bool hasMaxExpSumY() const { return hasMaxExpSumY_; }
-  bool hasMinExpSumX() const { return hasMinExpSumX_; }
-  bool hasMinExpSumY() const { return hasMinExpSumY_; }
-
   void setCenterLocation(int cx, int cy);
   void updateLocation(const GCell* gCell);
   void updateDensityLocation(const GCell* gCell);
@@ -481,29 +327,6 @@ class GPin
   int offsetCy_ = 0;
   int cx_ = 0;
   int cy_ = 0;
-
-  // weighted average WL vals stor for better indexing
-  // Please check the equation (4) in the ePlace-MS paper.
-  //
-  // maxExpSum_: holds exp(x_i/gamma)
-  // minExpSum_: holds exp(-x_i/gamma)
-  // the x_i is equal to cx_ variable.
-  //
-  float maxExpSumX_ = 0;
-  float maxExpSumY_ = 0;
-
-  float minExpSumX_ = 0;
-  float minExpSumY_ = 0;
-
-  // flag variables
-  //
-  // check whether
-  // this pin is considered in a WA models.
-  bool hasMaxExpSumX_ = false;
-  bool hasMaxExpSumY_ = false;
-
-  bool hasMinExpSumX_ = false;
-  bool hasMinExpSumY_ = false;
 };
 
 class Bin
@@ -672,6 +495,9 @@ class BinGrid
   void setTargetDensity(float density);
   void updateBinsGCellDensityArea(const std::vector<GCell*>& cells);
   void setNumThreads(int num_threads) { num_threads_ = num_threads; }
+  // Only re-accumulate the cells whose bin coverage changed since the
+  // previous update.
+  void setIncrementalDensity(bool incremental);
 
   void initBins();
 
@@ -706,6 +532,25 @@ class BinGrid
   void updateBinsNonPlaceArea();
 
  private:
+  // What a gCell added to the bins in the last density update
+  struct DensityBox
+  {
+    const GCell* cell = nullptr;
+    int lx = 0;
+    int ly = 0;
+    int ux = 0;
+    int uy = 0;
+    float scale = 0;
+  };
+
+  static DensityBox densityBox(const GCell* cell);
+  void addDensityArea(const DensityBox& box, bool remove);
+  bool sameDensityArea(const DensityBox& a, const DensityBox& b) const;
+  int enclosingBin(const DensityBox& box) const;
+  // Errors out if the bin areas differ from a full rebuild.
+  void checkDensityArea(const std::vector<GCell*>& cells);
+  void updateBinsDensity();
+
   std::vector<Bin> bins_;
   std::shared_ptr<PlacerBase> pb_;
   utl::Logger* log_ = nullptr;
@@ -722,6 +567,13 @@ class BinGrid
   int64_t overflowAreaUnscaled_ = 0;
   bool isSetBinCnt_ = false;
   int num_threads_ = 1;
+
+  bool incrementalDensity_ = false;
+  // empty when the next update has to rebuild all bins
+  std::vector<DensityBox> densityBoxes_;
+  int updatesSinceRebuild_ = 0;
+  // full rebuild every so many incremental updates
+  static constexpr int densityRebuildInterval_ = 50;
 };
 
 inline std::vector<Bin>& BinGrid::bins()
@@ -739,6 +591,7 @@ class NesterovBaseVars
   // temp variables
   bool isSetBinCnt = false;
   bool useUniformTargetDensity = false;
+  bool useIncrementalDensity = false;
 
   void reset();
 };
@@ -847,6 +700,52 @@ class NesterovBaseCommon
   std::unordered_map<Pin*, GPin*> gPinMap_;
   std::unordered_map<Net*, GNet*> gNetMap_;
 
+  //
+  // weighted average WL model stor for better indexing
+  // Please check the equation (4) in the ePlace-MS paper.
+  //
+  // WA: weighted Average
+  // saving four variables per direction will be helpful for
+  // calculating the WA gradients/wirelengths.
+  //
+  // expMinSumX: store sigma {exp(x_i/gamma)}
+  // xExpMinSumX: store signa {x_i*exp(e_i/gamma)}
+  // expMaxSumX : store sigma {exp(-x_i/gamma)}
+  // xExpMaxSumX: store sigma {x_i*exp(-x_i/gamma)}
+  //
+  struct WaNetSums
+  {
+    float expMinSumX = 0;
+    float xExpMinSumX = 0;
+    float expMaxSumX = 0;
+    float xExpMaxSumX = 0;
+
+    float expMinSumY = 0;
+    float yExpMinSumY = 0;
+    float expMaxSumY = 0;
+    float yExpMaxSumY = 0;
+  };
+
+  // slot of a pin in the WA arrays below, -1 if it is on no net
+  int waSlot(const GPin* gPin) const { return waSlots_[gPin - &gPinStor_[0]]; }
+
+  // The WA model is kept as arrays rather than in GNet/GPin.
+  // Pins are stored net by net: the pins of gNetStor_[i] use the slots
+  // [waNetStart_[i], waNetStart_[i + 1]).
+  std::vector<int> waSlots_;     // gPinStor_ index -> slot
+  std::vector<int> waNetStart_;  // gNetStor_ index -> first slot
+  std::vector<int> waSlotPin_;   // slot -> gPinStor_ index
+  std::vector<int> waSlotNet_;   // slot -> gNetStor_ index
+  std::vector<int> waPinX_;
+  std::vector<int> waPinY_;
+  // per pin exp((x_min - x_i)/gamma) and exp((x_i - x_max)/gamma),
+  // zero when the pin is not in the WA model
+  std::vector<float> waMinExpX_;
+  std::vector<float> waMaxExpX_;
+  std::vector<float> waMinExpY_;
+  std::vector<float> waMaxExpY_;
+  std::vector<WaNetSums> waNetSums_;
+
   int num_threads_;
 };
 
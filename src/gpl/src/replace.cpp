@@ -115,8 +115,11 @@ void Replace::reset()
   routabilityMaxInflationIter_ = 4;
 
   timingDrivenMode_ = true;
+  timingDrivenIncrementalMode_ = false;
   routabilityDrivenMode_ = true;
+  routabilityUseRudy_ = false;
   uniformTargetDensityMode_ = false;
+  incrementalDensityMode_ = false;
   skipIoMode_ = false;
 
   padLeft_ = padRight_ = 0;
@@ -301,6 +304,7 @@ bool Replace::initNesterovPlace(int threads)
     }
 
     nbVars.useUniformTargetDensity = uniformTargetDensityMode_;
+    nbVars.useIncrementalDensity = incrementalDensityMode_;
 
     nbc_ = std::make_shared<NesterovBaseCommon>(nbVars, pbc_, log_, threads);
 
@@ -321,6 +325,7 @@ bool Replace::initNesterovPlace(int threads)
     rbVars.rcK2 = routabilityRcK2_;
     rbVars.rcK3 = routabilityRcK3_;
     rbVars.rcK4 = routabilityRcK4_;
+    rbVars.useRudy = routabilityUseRudy_;
 
     rb_ = std::make_shared<RouteBase>(rbVars, db_, fr_, nbc_, nbVec_, log_);
   }
@@ -329,6 +334,8 @@ bool Replace::initNesterovPlace(int threads)
     tb_ = std::make_shared<TimingBase>(nbc_, rs_, log_);
     tb_->setTimingNetWeightOverflows(timingNetWeightOverflows_);
     tb_->setTimingNetWeightMax(timingNetWeightMax_);
+    // nets are re-estimated once a pin moved by a row height
+    tb_->setIncrementalMode(timingDrivenIncrementalMode_, pbc_->siteSizeY());
   }
 
   if (!np_) {
@@ -430,6 +437,11 @@ void Replace::setUniformTargetDensityMode(bool mode)
   uniformTargetDensityMode_ = mode;
 }
 
+void Replace::setIncrementalDensityMode(bool mode)
+{
+  incrementalDensityMode_ = mode;
+}
+
 float Replace::getUniformTargetDensity(int threads)
 {
   // TODO: update to be compatible with multiple target densities
@@ -498,6 +510,11 @@ void Replace::setRoutabilityDrivenMode(bool mode)
   routabilityDrivenMode_ = mode;
 }
 
+void Replace::setRoutabilityUseRudy(bool mode)
+{
+  routabilityUseRudy_ = mode;
+}
+
 void Replace::setRoutabilityCheckOverflow(float overflow)
 {
   routabilityCheckOverflow_ = overflow;
@@ -564,4 +581,9 @@ void Replace::setTimingNetWeightMax(float max)
   timingNetWeightMax_ = max;
 }
 
+void Replace::setTimingDrivenIncrementalMode(bool mode)
+{
+  timingDrivenIncrementalMode_ = mode;
+}
+
 }  // namespace gpl
@@ -68,6 +68,13 @@ set_uniform_target_density_mode_cmd(bool uniform)
   replace->setUniformTargetDensityMode(uniform);
 }
 
+void
+set_incremental_density_mode_cmd(bool mode)
+{
+  Replace* replace = getReplace();
+  replace->setIncrementalDensityMode(mode);
+}
+
 void
 set_initial_place_max_iter_cmd(int iter)
 {
@@ -168,6 +175,13 @@ set_routability_driven_mode(bool routability_driven)
   replace->setRoutabilityDrivenMode(routability_driven);
 }
 
+void
+set_routability_use_rudy_cmd(bool use_rudy)
+{
+  Replace* replace = getReplace();
+  replace->setRoutabilityUseRudy(use_rudy);
+}
+
 void
 set_routability_check_overflow_cmd(float overflow) 
 {
@@ -271,6 +285,13 @@ set_timing_driven_net_weight_max_cmd(float max)
   return replace->setTimingNetWeightMax(max);
 }
 
+void
+set_timing_driven_incremental_mode_cmd(bool mode)
+{
+  Replace* replace = getReplace();
+  replace->setTimingDrivenIncrementalMode(mode);
+}
+
 
 
 void
@@ -38,9 +38,11 @@ sta::define_cmd_args "global_placement" {\
     [-routability_driven]\
     [-disable_timing_driven]\
     [-disable_routability_driven]\
+    [-routability_use_rudy]\
     [-incremental]\
     [-force_cpu]\
     [-skip_io]\
+    [-incremental_density]\
     [-bin_grid_count grid_count]\
     [-density target_density]\
     [-init_density_penalty init_density_penalty]\
@@ -62,6 +64,7 @@ sta::define_cmd_args "global_placement" {\
     [-timing_driven_net_reweight_overflow timing_driven_net_reweight_overflow]\
     [-timing_driven_net_weight_max timing_driven_net_weight_max]\
     [-timing_driven_nets_percentage timing_driven_nets_percentage]\
+    [-timing_driven_incremental]\
     [-pad_left pad_left]\
     [-pad_right pad_right]\
 }
@@ -88,8 +91,11 @@ proc global_placement { args } {
       -timing_driven \
       -routability_driven \
       -disable_timing_driven \
+      -timing_driven_incremental \
       -disable_routability_driven \
+      -routability_use_rudy \
       -skip_io \
+      -incremental_density \
       -incremental\
       -force_cpu}
 
@@ -140,6 +146,9 @@ proc global_placement { args } {
     if { [info exists keys(-timing_driven_nets_percentage)] } {
       rsz::set_worst_slack_nets_percent $keys(-timing_driven_nets_percentage)
     }
+
+    gpl::set_timing_driven_incremental_mode_cmd \
+      [info exists flags(-timing_driven_incremental)]
   }
 
   if { [info exists flags(-disable_timing_driven)] } {
@@ -184,6 +193,12 @@ proc global_placement { args } {
 
   gpl::set_uniform_target_density_mode_cmd $uniform_mode
 
+  gpl::set_incremental_density_mode_cmd \
+    [info exists flags(-incremental_density)]
+
+  gpl::set_routability_use_rudy_cmd \
+    [info exists flags(-routability_use_rudy)]
+
   if { [info exists keys(-routability_max_density)] } {
     set routability_max_density $keys(-routability_max_density)
     sta::check_positive_float "-routability_max_density" $routability_max_density
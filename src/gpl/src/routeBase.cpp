@@ -40,6 +40,7 @@
 #include <utility>
 
 #include "grt/GlobalRouter.h"
+#include "grt/Rudy.h"
 #include "nesterovBase.h"
 #include "odb/db.h"
 #include "utl/Logger.h"
@@ -251,6 +252,7 @@ void RouteBaseVars::reset()
   rcK3 = rcK4 = 0.0;
   maxBloatIter = 1;
   maxInflationIter = 4;
+  useRudy = false;
 }
 
 /////////////////////////////////////////////
@@ -293,6 +295,10 @@ void RouteBase::reset()
   minRcCellSize_.clear();
   minRcCellSize_.shrink_to_fit();
 
+  rudyRatios_.clear();
+  rudyScale_ = 0;
+  rudyFallback_ = false;
+
   resetRoutabilityResources();
 }
 
@@ -331,6 +337,82 @@ void RouteBase::getGlobalRouterResult()
   updateRoute();
 }
 
+void RouteBase::getRudyResult()
+{
+  updateRudyRatios();
+
+  grt::Rudy* rudy = grouter_->getRudy();
+  const auto [tileCntX, tileCntY] = rudy->getGridSize();
+  const odb::Rect dieRect = db_->getChip()->getBlock()->getDieArea();
+
+  tg_->setNumRoutingLayers(db_->getTech()->getRoutingLayerCount());
+  tg_->setLx(dieRect.xMin());
+  tg_->setLy(dieRect.yMin());
+  tg_->setTileSize(rudy->getTileSize(), rudy->getTileSize());
+  tg_->setTileCnt(tileCntX, tileCntY);
+  tg_->initTiles();
+
+  for (auto& tile : tg_->tiles()) {
+    const float ratio = rudyRatios_[tile->y() * tg_->tileCntX() + tile->x()];
+
+    // update inflation Ratio
+    if (ratio >= rbVars_.minInflationRatio) {
+      float inflationRatio = std::pow(ratio, rbVars_.inflationRatioCoef);
+      inflationRatio = std::fmin(inflationRatio, rbVars_.maxInflationRatio);
+      tile->setInflationRatio(inflationRatio);
+    }
+  }
+}
+
+void RouteBase::updateRudyRatios()
+{
+  // update gCells' location to DB for RUDY
+  nbc_->updateDbGCells();
+
+  // RUDY takes the grid and the resource reductions from FastRoute,
+  // which resetRoutabilityResources() clears after every call
+  dbBlock* block = db_->getChip()->getBlock();
+  if (!grouter_->isInitialized()) {
+    int minLayer, maxLayer;
+    grouter_->setDbBlock(block);
+    grouter_->getMinMaxLayer(minLayer, maxLayer);
+    grouter_->initFastRoute(minLayer, maxLayer);
+  }
+
+  grt::Rudy* rudy = grouter_->getRudy();
+  rudy->calculateRudy();
+
+  const auto [tileCntX, tileCntY] = rudy->getGridSize();
+  rudyRatios_.assign(static_cast<size_t>(tileCntX) * tileCntY, 0);
+  for (int y = 0; y < tileCntY; y++) {
+    for (int x = 0; x < tileCntX; x++) {
+      // RUDY is the wire area over the tile area, in percent; the scale
+      // brings it to the usage/capacity ratios of the global router.
+      rudyRatios_[y * tileCntX + x]
+          = rudy->getTile(x, y).getRudy() / 100.0f * rudyScale_;
+    }
+  }
+}
+
+// RUDY measures wire density rather than usage over capacity, so its
+// ratios are not on the scale targetRC and minInflationRatio are tuned
+// for.  RC is linear in the tile ratios, so a single factor that makes
+// the RUDY RC match the global router RC of the same placement puts
+// them on the router's scale.
+void RouteBase::calibrateRudy(float routerRc)
+{
+  rudyScale_ = 1.0;
+  updateRudyRatios();
+  const float rudyRc = getRudyRC();
+  rudyScale_ = rudyRc > 0 ? routerRc / rudyRc : 1.0;
+
+  log_->info(GPL,
+             85,
+             "RUDY RC ({:.4f}) scaled by {:.4f} to the global router RC.",
+             rudyRc,
+             rudyScale_);
+}
+
 int64_t RouteBase::inflatedAreaDelta() const
 {
   return inflatedAreaDelta_;
@@ -511,11 +593,50 @@ std::pair<bool, bool> RouteBase::routability()
   tg_ = std::move(tg);
   tg_->setLogger(log_);
 
-  getGlobalRouterResult();
+  float curRc = 0;
+  if (rbVars_.useRudy && !rudyFallback_ && rudyScale_ > 0) {
+    getRudyResult();
+    curRc = getRudyRC();
+
+    // RUDY is only an estimate, so confirm with the global router
+    // before leaving the routability procedure
+    if (curRc < rbVars_.targetRC) {
+      log_->info(GPL,
+                 81,
+                 "RUDY RC lower than targetRC({}), confirming with global "
+                 "router.",
+                 rbVars_.targetRC);
+      resetRoutabilityResources();
+      std::unique_ptr<TileGrid> routerTg(new TileGrid());
+      tg_ = std::move(routerTg);
+      tg_->setLogger(log_);
+
+      getGlobalRouterResult();
+      curRc = getRC();
+
+      if (curRc >= rbVars_.targetRC) {
+        log_->info(GPL,
+                   82,
+                   "Global router RC ({:.4f}) higher than targetRC, using "
+                   "global router for the remaining iterations.",
+                   curRc);
+        // the scaled RUDY RCs saved so far were too optimistic
+        rudyFallback_ = true;
+        minRc_ = 1e30;
+        minRcViolatedCnt_ = 0;
+      }
+    }
+  } else {
+    getGlobalRouterResult();
+    curRc = getRC();
 
-  // no need routing if RC is lower than targetRC val
-  float curRc = getRC();
+    // the first call routes, and RUDY is calibrated against it
+    if (rbVars_.useRudy && !rudyFallback_) {
+      calibrateRudy(curRc);
+    }
+  }
 
+  // no need routing if RC is lower than targetRC val
   if (curRc < rbVars_.targetRC) {
     log_->info(GPL,
                77,
@@ -803,6 +924,31 @@ float RouteBase::getRC() const
   log_->info(GPL, 64, "TotalRouteOverflowV2: {}", totalRouteOverflowV2);
   log_->info(GPL, 65, "OverflowTileCnt2: {}", overflowTileCnt2);
 
+  return getFinalRC(horEdgeCongArray, verEdgeCongArray);
+}
+
+// extract RC values from the RUDY map
+float RouteBase::getRudyRC() const
+{
+  // RUDY has no layer direction, so the same
+  // ratios stand for both directions
+  std::vector<double> horEdgeCongArray(rudyRatios_.begin(), rudyRatios_.end());
+  std::vector<double> verEdgeCongArray(horEdgeCongArray);
+
+  int overflowTileCnt = 0;
+  for (const float ratio : rudyRatios_) {
+    if (ratio > 1.0) {
+      overflowTileCnt++;
+    }
+  }
+  log_->info(GPL, 83, "RudyOverflowTileCnt: {}", overflowTileCnt);
+
+  return getFinalRC(horEdgeCongArray, verEdgeCongArray);
+}
+
+float RouteBase::getFinalRC(std::vector<double>& horEdgeCongArray,
+                            std::vector<double>& verEdgeCongArray) const
+{
   int horArraySize = horEdgeCongArray.size();
   int verArraySize = verEdgeCongArray.size();
 
@@ -164,6 +164,10 @@ class RouteBaseVars
   int maxBloatIter;
   int maxInflationIter;
 
+  // estimate congestion with RUDY in the inflation loop and
+  // only run the global router for the final confirmation.
+  bool useRudy;
+
   RouteBaseVars();
   void reset();
 };
@@ -185,6 +189,11 @@ class RouteBase
   void updateRoute();
   void getGlobalRouterResult();
 
+  // update Route info from the RUDY map of GlobalRouter
+  void getRudyResult();
+  // fit the RUDY ratios to the global router RC of the same placement
+  void calibrateRudy(float routerRc);
+
   // first: is Routability Need
   // second: reverting procedure need in NesterovPlace
   //         (e.g. calling NesterovPlace's init())
@@ -196,6 +205,7 @@ class RouteBase
   int inflationIterCnt() const;
 
   float getRC() const;
+  float getRudyRC() const;
 
   void revertGCellSizeToMinRc();
 
@@ -225,6 +235,14 @@ class RouteBase
   int minRcViolatedCnt_ = 0;
   std::vector<std::pair<int, int>> minRcCellSize_;
 
+  // RUDY ratio of each tile, filled by updateRudyRatios()
+  std::vector<float> rudyRatios_;
+  // RUDY to global router ratio scale, 0 until calibrateRudy()
+  float rudyScale_ = 0;
+  // set when the global router rejected a RUDY-based RC;
+  // the remaining iterations use the global router.
+  bool rudyFallback_ = false;
+
   void init();
   void reset();
   void resetRoutabilityResources();
@@ -234,5 +252,10 @@ class RouteBase
 
   // routability funcs
   void initGCells();
+  void updateRudyRatios();
+
+  // combine the most congested edges into the final RC
+  float getFinalRC(std::vector<double>& horEdgeCongArray,
+                   std::vector<double>& verEdgeCongArray) const;
 };
 }  // namespace gpl
@@ -142,9 +142,74 @@ void TimingBase::setTimingNetWeightMax(float max)
   net_weight_max_ = max;
 }
 
+void TimingBase::setIncrementalMode(bool mode, int moveThreshold)
+{
+  incrementalMode_ = mode;
+  moveThreshold_ = moveThreshold;
+  netPinStart_.clear();
+  netPinLoc_.clear();
+}
+
+void TimingBase::saveNetPinLocs()
+{
+  netPinStart_.clear();
+  netPinLoc_.clear();
+  netPinStart_.reserve(nbc_->gNets().size() + 1);
+  for (auto& gNet : nbc_->gNets()) {
+    netPinStart_.push_back(netPinLoc_.size());
+    for (auto& gPin : gNet->gPins()) {
+      netPinLoc_.emplace_back(gPin->cx(), gPin->cy());
+    }
+  }
+  netPinStart_.push_back(netPinLoc_.size());
+}
+
+void TimingBase::findMovedNets(std::vector<odb::dbNet*>& movedNets)
+{
+  const auto& gNets = nbc_->gNets();
+  for (size_t i = 0; i < gNets.size(); i++) {
+    GNet* gNet = gNets[i];
+    const int start = netPinStart_[i];
+    const auto& gPins = gNet->gPins();
+
+    bool moved = false;
+    for (size_t j = 0; j < gPins.size(); j++) {
+      const auto& [x, y] = netPinLoc_[start + j];
+      if (std::abs(gPins[j]->cx() - x) > moveThreshold_
+          || std::abs(gPins[j]->cy() - y) > moveThreshold_) {
+        moved = true;
+        break;
+      }
+    }
+    if (!moved) {
+      continue;
+    }
+
+    // the saved locations follow the estimated parasitics,
+    // so small moves still add up to a re-estimation
+    for (size_t j = 0; j < gPins.size(); j++) {
+      netPinLoc_[start + j] = std::make_pair(gPins[j]->cx(), gPins[j]->cy());
+    }
+    movedNets.push_back(gNet->net()->dbNet());
+  }
+}
+
 bool TimingBase::updateGNetWeights(float overflow)
 {
-  rs_->findResizeSlacks();
+  if (incrementalMode_ && !netPinStart_.empty()) {
+    std::vector<odb::dbNet*> movedNets;
+    findMovedNets(movedNets);
+    log_->info(GPL,
+               84,
+               "Re-estimating parasitics of {} moved nets.",
+               movedNets.size());
+    rs_->findResizeSlacks(movedNets);
+  } else {
+    rs_->findResizeSlacks();
+    if (incrementalMode_) {
+      saveNetPinLocs();
+    }
+  }
 
   // get worst resize nets
   sta::NetSeq& worst_slack_nets = rs_->resizeWorstSlackNets();
@@ -167,12 +232,21 @@ bool TimingBase::updateGNetWeights(float overflow)
     return false;
   }
 
-  int weighted_net_count = 0;
+  // look up all the net slacks at once
+  std::vector<odb::dbNet*> db_nets;
+  db_nets.reserve(nbc_->gNets().size());
   for (auto& gNet : nbc_->gNets()) {
+    db_nets.push_back(gNet->net()->dbNet());
+  }
+  const auto net_slacks = rs_->resizeNetSlacks(db_nets);
+
+  int weighted_net_count = 0;
+  for (size_t i = 0; i < nbc_->gNets().size(); i++) {
+    GNet* gNet = nbc_->gNets()[i];
     // default weight
     gNet->setTimingWeight(1.0);
     if (gNet->gPins().size() > 1) {
-      auto net_slack_opt = rs_->resizeNetSlack(gNet->net()->dbNet());
+      const auto& net_slack_opt = net_slacks[i];
       if (!net_slack_opt) {
         continue;
       }
@@ -34,8 +34,13 @@
 #pragma once
 
 #include <memory>
+#include <utility>
 #include <vector>
 
+namespace odb {
+class dbNet;
+}
+
 namespace rsz {
 class Resizer;
 }
@@ -67,6 +72,10 @@ class TimingBase
 
   void setTimingNetWeightMax(float max);
 
+  // incremental mode: after the first reweight, only the nets with
+  // a pin that moved more than moveThreshold (DBU) get new parasitics
+  void setIncrementalMode(bool mode, int moveThreshold);
+
   // updateNetWeight.
   // True: successfully reweighted gnets
   // False: no slacks found
@@ -80,7 +89,17 @@ class TimingBase
   std::vector<int> timingNetWeightOverflow_;
   std::vector<int> timingOverflowChk_;
   float net_weight_max_ = 1.9;
+
+  bool incrementalMode_ = false;
+  int moveThreshold_ = 0;
+  // pin locations when the parasitics of each net were last estimated.
+  // The pins of gNets()[i] use [netPinStart_[i], netPinStart_[i + 1]).
+  std::vector<int> netPinStart_;
+  std::vector<std::pair<int, int>> netPinLoc_;
+
   void initTimingOverflowChk();
+  void saveNetPinLocs();
+  void findMovedNets(std::vector<odb::dbNet*>& movedNets);
 };
 
 }  // namespace gpl
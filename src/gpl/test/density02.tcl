@@ -0,0 +1,18 @@
+# simple01 with incremental bin density updates.  The densityCheck debug
+# group compares every incremental update against a full rebuild, and the
+# bin areas are integers, so the result must match simple01.defok.
+source helpers.tcl
+set test_name density02
+read_lef ./nangate45.lef
+read_def ./simple01.def
+
+set_debug_level GPL densityCheck 1
+global_placement -init_density_penalty 0.01 -skip_initial_place \
+  -incremental_density
+set def_file [make_result_file $test_name.def]
+write_def $def_file
+if { [diff_files $def_file simple01.defok] } {
+  exit 1
+}
+puts "pass"
+exit
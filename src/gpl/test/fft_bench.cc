@@ -0,0 +1,119 @@
+// Times FFT::doFFT against the 2D Ooura routines it replaced.
+//
+// usage: fft_bench [bin_cnt] [iterations] [threads]
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "spdlog/fmt/fmt.h"
+#include "src/gpl/src/fft.h"
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double seconds(Clock::time_point start)
+{
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// The transforms done by the previous FFT::doFFT.  The phi/force
+// post-processing is left out, so this is a lower bound for the old path.
+double time_ooura(int bin_cnt, int iterations, const std::vector<float>& input)
+{
+  std::vector<float> cs_table(bin_cnt * 3 / 2, 0);
+  std::vector<int> work_area(std::round(std::sqrt(bin_cnt)) + 2, 0);
+  std::vector<std::vector<float>> grids(4, input);
+  std::vector<std::vector<float*>> rows(4);
+  for (int k = 0; k < 4; k++) {
+    for (int i = 0; i < bin_cnt; i++) {
+      rows[k].push_back(&grids[k][i * bin_cnt]);
+    }
+  }
+
+  auto start = Clock::now();
+  for (int iter = 0; iter < iterations; iter++) {
+    gpl::ddct2d(bin_cnt,
+                bin_cnt,
+                -1,
+                rows[0].data(),
+                nullptr,
+                work_area.data(),
+                cs_table.data());
+    gpl::ddct2d(bin_cnt,
+                bin_cnt,
+                1,
+                rows[1].data(),
+                nullptr,
+                work_area.data(),
+                cs_table.data());
+    gpl::ddsct2d(bin_cnt,
+                 bin_cnt,
+                 1,
+                 rows[2].data(),
+                 nullptr,
+                 work_area.data(),
+                 cs_table.data());
+    gpl::ddcst2d(bin_cnt,
+                 bin_cnt,
+                 1,
+                 rows[3].data(),
+                 nullptr,
+                 work_area.data(),
+                 cs_table.data());
+  }
+  return seconds(start);
+}
+
+double time_fft(int bin_cnt,
+                int iterations,
+                int threads,
+                const std::vector<float>& input)
+{
+  gpl::FFT fft(bin_cnt, bin_cnt, 1, 1, threads);
+
+  auto start = Clock::now();
+  for (int iter = 0; iter < iterations; iter++) {
+    for (int x = 0; x < bin_cnt; x++) {
+      for (int y = 0; y < bin_cnt; y++) {
+        fft.updateDensity(x, y, input[x * bin_cnt + y]);
+      }
+    }
+    fft.doFFT();
+  }
+  return seconds(start);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  const int bin_cnt = argc > 1 ? std::atoi(argv[1]) : 1024;
+  const int iterations = argc > 2 ? std::atoi(argv[2]) : 10;
+  const int threads = argc > 3 ? std::atoi(argv[3]) : 8;
+
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(0.0, 2.0);
+  std::vector<float> input(bin_cnt * bin_cnt);
+  for (float& d : input) {
+    d = dist(rng);
+  }
+
+  std::cout << fmt::format("{}x{} bins, {} iterations\n",
+                           bin_cnt,
+                           bin_cnt,
+                           iterations);
+  std::cout << fmt::format("ooura 2D:           {:8.3f} s\n",
+                           time_ooura(bin_cnt, iterations, input));
+  std::cout << fmt::format("FFT 1 thread:       {:8.3f} s\n",
+                           time_fft(bin_cnt, iterations, 1, input));
+  std::cout << fmt::format("FFT {:2d} threads:     {:8.3f} s\n",
+                           threads,
+                           time_fft(bin_cnt, iterations, threads, input));
+  return 0;
+}
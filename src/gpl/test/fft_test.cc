@@ -1,8 +1,12 @@
 #include "src/gpl/src/fft.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
+#include <vector>
 
 #include "gtest/gtest.h"
 #include "spdlog/fmt/fmt.h"
@@ -146,4 +150,131 @@ TEST(FloatFFTTest, Basic)
   }
 }
 
+// Previous FFT::doFFT, run through the 2D Ooura routines.
+void ooura_fft(int cnt_x,
+               int cnt_y,
+               int size_x,
+               int size_y,
+               std::vector<std::vector<float>>& density,
+               std::vector<std::vector<float>>& phi,
+               std::vector<std::vector<float>>& force_x,
+               std::vector<std::vector<float>>& force_y)
+{
+  const long double pi = 3.141592653589793238462L;
+  const int n = std::max(cnt_x, cnt_y);
+  std::vector<float> cs_table(n * 3 / 2, 0);
+  std::vector<int> work_area(std::round(std::sqrt(n)) + 2, 0);
+  auto rows = [](std::vector<std::vector<float>>& a) {
+    std::vector<float*> ptrs;
+    for (auto& row : a) {
+      ptrs.push_back(row.data());
+    }
+    return ptrs;
+  };
+
+  auto density_rows = rows(density);
+  gpl::ddct2d(cnt_x,
+              cnt_y,
+              -1,
+              density_rows.data(),
+              nullptr,
+              work_area.data(),
+              cs_table.data());
+  for (int i = 0; i < cnt_x; i++) {
+    density[i][0] *= 0.5;
+  }
+  for (int i = 0; i < cnt_y; i++) {
+    density[0][i] *= 0.5;
+  }
+  for (int i = 0; i < cnt_x; i++) {
+    float wx = pi * static_cast<float>(i) / static_cast<float>(cnt_x);
+    for (int j = 0; j < cnt_y; j++) {
+      float wy = pi * static_cast<float>(j) / static_cast<float>(cnt_y)
+                 * static_cast<float>(size_y) / static_cast<float>(size_x);
+      density[i][j] *= 4.0 / cnt_x / cnt_y;
+      if (i == 0 && j == 0) {
+        phi[i][j] = force_x[i][j] = force_y[i][j] = 0.0f;
+        continue;
+      }
+      phi[i][j] = density[i][j] / (wx * wx + wy * wy);
+      force_x[i][j] = phi[i][j] * wx;
+      force_y[i][j] = phi[i][j] * wy;
+    }
+  }
+
+  auto phi_rows = rows(phi);
+  auto force_x_rows = rows(force_x);
+  auto force_y_rows = rows(force_y);
+  gpl::ddct2d(cnt_x,
+              cnt_y,
+              1,
+              phi_rows.data(),
+              nullptr,
+              work_area.data(),
+              cs_table.data());
+  gpl::ddsct2d(cnt_x,
+               cnt_y,
+               1,
+               force_x_rows.data(),
+               nullptr,
+               work_area.data(),
+               cs_table.data());
+  gpl::ddcst2d(cnt_x,
+               cnt_y,
+               1,
+               force_y_rows.data(),
+               nullptr,
+               work_area.data(),
+               cs_table.data());
+}
+
+TEST(FloatFFTTest, MatchesOoura2D)
+{
+  const int cnt_x = 64;
+  const int cnt_y = 32;
+  const int size_x = 10;
+  const int size_y = 20;
+
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<float> dist(0.0, 2.0);
+  std::vector<std::vector<float>> density(cnt_x, std::vector<float>(cnt_y));
+  for (auto& row : density) {
+    for (float& d : row) {
+      d = dist(rng);
+    }
+  }
+
+  auto phi = density;
+  auto force_x = density;
+  auto force_y = density;
+  auto ref_density = density;
+  ooura_fft(cnt_x,
+            cnt_y,
+            size_x,
+            size_y,
+            ref_density,
+            phi,
+            force_x,
+            force_y);
+
+  for (int threads : {1, 4}) {
+    gpl::FFT fft(cnt_x, cnt_y, size_x, size_y, threads);
+    for (int x = 0; x < cnt_x; x++) {
+      for (int y = 0; y < cnt_y; y++) {
+        fft.updateDensity(x, y, density[x][y]);
+      }
+    }
+    fft.doFFT();
+
+    for (int x = 0; x < cnt_x; x++) {
+      for (int y = 0; y < cnt_y; y++) {
+        auto eForce = fft.getElectroForce(x, y);
+        EXPECT_EQ(eForce.first, force_x[x][y]);
+        EXPECT_EQ(eForce.second, force_y[x][y]);
+        EXPECT_EQ(fft.getElectroPhi(x, y), phi[x][y]);
+      }
+    }
+  }
+}
+
 }  // namespace
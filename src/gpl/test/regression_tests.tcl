@@ -31,3 +31,8 @@ record_tests {
   #gpl_readme_msgs_check
 }
 #  clust02
+
+record_pass_fail_tests {
+  density02
+  simple02-rd-rudy
+}
@@ -0,0 +1,69 @@
+# simple02-rd with reduced routing capacity, so routability mode has to
+# inflate cells.  The RUDY run must remove at least half of the overflow
+# that the router-driven run removes from a plain placement.
+source helpers.tcl
+set test_name simple02-rd-rudy
+read_liberty ./library/nangate45/NangateOpenCellLibrary_typical.lib
+
+read_lef ./nangate45.lef
+read_def ./simple02-rd.def
+
+grt::add_layer_adjustment 2 0.6
+grt::add_layer_adjustment 3 0.6
+grt::add_layer_adjustment 4 0.5
+grt::add_layer_adjustment 5 0.5
+grt::add_layer_adjustment 6 0.5
+grt::add_layer_adjustment 7 0.5
+grt::add_layer_adjustment 8 0.5
+grt::add_layer_adjustment 9 0.5
+grt::add_layer_adjustment 10 0.5
+
+set block [ord::get_db_block]
+set locations {}
+foreach inst [$block getInsts] {
+  lappend locations $inst [$inst getLocation] [$inst getPlacementStatus]
+}
+
+proc restore_placement { locations } {
+  foreach { inst location status } $locations {
+    $inst setLocation {*}$location
+    $inst setPlacementStatus $status
+  }
+}
+
+proc total_overflow { name } {
+  global test_name
+  set report_file [make_result_file $test_name-$name.rpt]
+  global_route -allow_congestion -congestion_report_file $report_file
+  set stream [open $report_file r]
+  set overflow 0
+  foreach { match count } [regexp -all -inline {overflow:(-?\d+)} [read $stream]] {
+    incr overflow $count
+  }
+  close $stream
+  return $overflow
+}
+
+global_placement
+set plain_overflow [total_overflow plain]
+
+restore_placement $locations
+global_placement -routability_driven -routability_target_rc_metric 1.0
+set router_overflow [total_overflow router]
+
+restore_placement $locations
+global_placement -routability_driven -routability_use_rudy \
+  -routability_target_rc_metric 1.0
+set rudy_overflow [total_overflow rudy]
+
+puts "overflow plain: $plain_overflow router: $router_overflow rudy: $rudy_overflow"
+if { $router_overflow >= $plain_overflow } {
+  puts "routability mode did not reduce the overflow"
+  exit 1
+}
+if { $plain_overflow - $rudy_overflow < ($plain_overflow - $router_overflow) / 2.0 } {
+  puts "RUDY inflation removed less than half of the router-driven reduction"
+  exit 1
+}
+puts "pass"
+exit
@@ -213,6 +213,12 @@ class GlobalRouter : public ant::GlobalRouteSource
   // See class IncrementalGRoute.
   void addDirtyNet(odb::dbNet* net);
   std::set<odb::dbNet*> getDirtyNets() { return dirty_nets_; }
+  // Nets whose route, pins or pin cells changed since their parasitics
+  // were last estimated. estimateRC removes the net from the set.
+  const std::set<odb::dbNet*>& getParasiticsDirtyNets()
+  {
+    return parasitics_dirty_nets_;
+  }
   // check_antennas
   bool haveRoutes() override;
   bool haveDetailedRoutes();
@@ -298,7 +304,9 @@ class GlobalRouter : public ant::GlobalRouteSource
   void setCapacities(int min_routing_layer, int max_routing_layer);
   void initNetlist(std::vector<Net*>& nets);
   bool makeFastrouteNet(Net* net);
-  bool pinPositionsChanged(Net* net, std::vector<odb::Point>& last_pos);
+  bool pinPositionsChanged(Net* net,
+                           std::vector<odb::Point>& last_pos,
+                           bool on_grid = true);
   std::vector<LayerId> findTransitionLayers();
   void adjustTransitionLayers(
       const std::vector<LayerId>& transition_layers,
@@ -479,6 +487,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   odb::dbBlock* block_;
 
   std::set<odb::dbNet*> dirty_nets_;
+  std::set<odb::dbNet*> parasitics_dirty_nets_;
   std::vector<odb::dbNet*> nets_to_route_;
 
   RepairAntennas* repair_antennas_;
@@ -58,13 +58,14 @@
 #include "MakeWireParasitics.h"
 #include "RepairAntennas.h"
 #include "RoutingTracks.h"
-#include "Rudy.h"
 #include "db_sta/dbNetwork.hh"
 #include "db_sta/dbSta.hh"
 #include "grt/GRoute.h"
+#include "grt/Rudy.h"
 #include "odb/db.h"
 #include "odb/dbShape.h"
 #include "odb/wOrder.h"
+#include "ord/OpenRoad.hh"
 #include "sta/Clock.hh"
 #include "sta/MinMax.hh"
 #include "sta/Parasitics.hh"
@@ -147,6 +148,7 @@ void GlobalRouter::init(utl::Logger* logger,
 void GlobalRouter::clear()
 {
   routes_.clear();
+  parasitics_dirty_nets_.clear();
   for (auto [ignored, net] : db_net_map_) {
     delete net;
   }
@@ -389,6 +391,7 @@ NetRouteMap GlobalRouter::findRouting(std::vector<Net*>& nets,
     MakeWireParasitics builder(
         logger_, resizer_, sta_, db_->getTech(), block_, this);
     fastroute_->setMakeWireParasiticsBuilder(&builder);
+    fastroute_->setThreadCount(ord::OpenRoad::openRoad()->getThreadCount());
     routes = fastroute_->run();
     fastroute_->setMakeWireParasiticsBuilder(nullptr);
     addRemainingGuides(routes, nets, min_routing_layer, max_routing_layer);
@@ -410,6 +413,7 @@ void GlobalRouter::estimateRC()
 
   // Make separate parasitics for each corner.
   sta_->setParasiticAnalysisPts(true);
+  parasitics_dirty_nets_.clear();
 
   MakeWireParasitics builder(
       logger_, resizer_, sta_, db_->getTech(), block_, this);
@@ -425,6 +429,7 @@ void GlobalRouter::estimateRC()
 
 void GlobalRouter::estimateRC(odb::dbNet* db_net)
 {
+  parasitics_dirty_nets_.erase(db_net);
   MakeWireParasitics builder(
       logger_, resizer_, sta_, db_->getTech(), block_, this);
   auto iter = routes_.find(db_net);
@@ -551,8 +556,10 @@ void GlobalRouter::updateDirtyNets(std::vector<Net*>& dirty_nets)
     Net* net = db_net_map_[db_net];
     // get last pin positions
     std::vector<odb::Point> last_pos;
+    std::vector<odb::Point> last_exact_pos;
     for (const Pin& pin : net->getPins()) {
       last_pos.push_back(pin.getOnGridPosition());
+      last_exact_pos.push_back(pin.getPosition());
     }
     net->destroyPins();
     // update pin positions
@@ -564,6 +571,10 @@ void GlobalRouter::updateDirtyNets(std::vector<Net*>& dirty_nets)
     if (pinPositionsChanged(net, last_pos)) {
       dirty_nets.push_back(db_net_map_[db_net]);
     }
+    // The pin to grid wires changed even if the route is kept.
+    if (pinPositionsChanged(net, last_exact_pos, false)) {
+      parasitics_dirty_nets_.insert(db_net);
+    }
   }
   dirty_nets_.clear();
 }
@@ -876,12 +887,13 @@ void GlobalRouter::initNetlist(std::vector<Net*>& nets)
 }
 
 bool GlobalRouter::pinPositionsChanged(Net* net,
-                                       std::vector<odb::Point>& last_pos)
+                                       std::vector<odb::Point>& last_pos,
+                                       bool on_grid)
 {
   bool is_diferent = false;
   std::map<odb::Point, int> cnt_pos;
   for (const Pin& pin : net->getPins()) {
-    cnt_pos[pin.getOnGridPosition()]++;
+    cnt_pos[on_grid ? pin.getOnGridPosition() : pin.getPosition()]++;
   }
   for (const odb::Point& last : last_pos) {
     cnt_pos[last]--;
@@ -2468,7 +2480,11 @@ void GlobalRouter::mergeResults(NetRouteMap& routes)
   for (auto& net_route : routes) {
     odb::dbNet* db_net = net_route.first;
     GRoute& route = net_route.second;
-    routes_[db_net] = route;
+    GRoute& old_route = routes_[db_net];
+    if (old_route != route) {
+      old_route = route;
+      parasitics_dirty_nets_.insert(db_net);
+    }
   }
 }
 
@@ -2991,6 +3007,7 @@ void GlobalRouter::removeNet(odb::dbNet* db_net)
   delete net;
   db_net_map_.erase(db_net);
   dirty_nets_.erase(db_net);
+  parasitics_dirty_nets_.erase(db_net);
   routes_.erase(db_net);
 }
 
@@ -4225,6 +4242,14 @@ void GRouteDbCbk::inDbPostMoveInst(odb::dbInst* inst)
 void GRouteDbCbk::inDbInstSwapMasterAfter(odb::dbInst* inst)
 {
   instItermsDirty(inst);
+  // The reduced parasitics include the pin caps of the new master even
+  // when the pins do not move.
+  for (odb::dbITerm* iterm : inst->getITerms()) {
+    odb::dbNet* db_net = iterm->getNet();
+    if (db_net != nullptr && !db_net->isSpecial()) {
+      grouter_->parasitics_dirty_nets_.insert(db_net);
+    }
+  }
 }
 
 void GRouteDbCbk::instItermsDirty(odb::dbInst* inst)
@@ -431,11 +431,11 @@ void RepairAntennas::destroyNetWires()
 void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
 {
   int site_width = -1;
-  r_tree fixed_insts;
   odb::dbTech* tech = db_->getTech();
 
   illegal_diode_placement_count_ = 0;
   diode_insts_.clear();
+  diode_inst_set_.clear();
 
   auto rows = block_->getRows();
   for (odb::dbRow* db_row : rows) {
@@ -454,7 +454,6 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
   }
 
   setInstsPlacementStatus(odb::dbPlacementStatus::FIRM);
-  getFixedInstances(fixed_insts);
 
   bool repair_failures = false;
   for (auto const& net_violations : antenna_violations_) {
@@ -479,7 +478,6 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
                         diode_mterm,
                         gate,
                         site_width,
-                        fixed_insts,
                         violation_layer);
             inserted_diodes = true;
           }
@@ -492,6 +490,8 @@ void RepairAntennas::repairAntennas(odb::dbMTerm* diode_mterm)
   }
   if (repair_failures)
     logger_->warn(GRT, 243, "Unable to repair antennas on net with diodes.");
+  // stop paying for index updates while the cells are legalized
+  block_->releaseRegionQuery();
 }
 
 void RepairAntennas::legalizePlacedCells()
@@ -505,7 +505,6 @@ void RepairAntennas::insertDiode(odb::dbNet* net,
                                  odb::dbMTerm* diode_mterm,
                                  odb::dbITerm* gate,
                                  int site_width,
-                                 r_tree& fixed_insts,
                                  odb::dbTechLayer* violation_layer)
 {
   odb::dbMaster* diode_master = diode_mterm->getMaster();
@@ -516,8 +515,8 @@ void RepairAntennas::insertDiode(odb::dbNet* net,
 
   bool place_vertically
       = violation_layer->getDirection() == odb::dbTechLayerDir::VERTICAL;
-  bool legally_placed = setDiodeLoc(
-      diode_inst, gate, site_width, place_vertically, fixed_insts);
+  bool legally_placed
+      = setDiodeLoc(diode_inst, gate, site_width, place_vertically);
 
   odb::Rect inst_rect = diode_inst->getBBox()->getBox();
 
@@ -541,31 +540,7 @@ void RepairAntennas::insertDiode(odb::dbNet* net,
       = diode_inst->findITerm(diode_mterm->getConstName());
   diode_iterm->connect(net);
   diode_insts_.push_back(diode_inst);
-
-  // Add diode to the R-tree of fixed instances
-  int fixed_inst_id = fixed_insts.size();
-  box b(point(inst_rect.xMin(), inst_rect.yMin()),
-        point(inst_rect.xMax(), inst_rect.yMax()));
-  value v(b, fixed_inst_id);
-  fixed_insts.insert(v);
-  fixed_inst_id++;
-}
-
-void RepairAntennas::getFixedInstances(r_tree& fixed_insts)
-{
-  int fixed_inst_id = 0;
-  for (odb::dbInst* inst : block_->getInsts()) {
-    odb::dbPlacementStatus status = inst->getPlacementStatus();
-    if (status == odb::dbPlacementStatus::FIRM
-        || status == odb::dbPlacementStatus::LOCKED) {
-      odb::dbBox* instBox = inst->getBBox();
-      box b(point(instBox->xMin(), instBox->yMin()),
-            point(instBox->xMax(), instBox->yMax()));
-      value v(b, fixed_inst_id);
-      fixed_insts.insert(v);
-      fixed_inst_id++;
-    }
-  }
+  diode_inst_set_.insert(diode_inst);
 }
 
 void RepairAntennas::setInstsPlacementStatus(
@@ -589,8 +564,7 @@ void RepairAntennas::setInstsPlacementStatus(
 bool RepairAntennas::setDiodeLoc(odb::dbInst* diode_inst,
                                  odb::dbITerm* gate,
                                  int site_width,
-                                 const bool place_vertically,
-                                 r_tree& fixed_insts)
+                                 const bool place_vertically)
 {
   const int max_legalize_itr = 50;
   bool place_at_left = true;
@@ -640,7 +614,7 @@ bool RepairAntennas::setDiodeLoc(odb::dbInst* diode_inst,
     diode_inst->setLocation(inst_loc_x + horizontal_offset,
                             inst_loc_y + vertical_offset);
 
-    legally_placed = checkDiodeLoc(diode_inst, site_width, fixed_insts);
+    legally_placed = checkDiodeLoc(diode_inst, site_width);
     legalize_itr++;
   }
 
@@ -664,22 +638,35 @@ void RepairAntennas::getInstancePlacementData(odb::dbITerm* gate,
 }
 
 bool RepairAntennas::checkDiodeLoc(odb::dbInst* diode_inst,
-                                   const int site_width,
-                                   r_tree& fixed_insts)
+                                   const int site_width)
 {
   const odb::Rect& core_area = block_->getCoreArea();
   const int left_pad = opendp_->padLeft(diode_inst);
   const int right_pad = opendp_->padRight(diode_inst);
   odb::dbBox* instBox = diode_inst->getBBox();
-  box box(point(instBox->xMin() - ((left_pad + right_pad) * site_width) + 1,
-                instBox->yMin() + 1),
-          point(instBox->xMax() + ((left_pad + right_pad) * site_width) - 1,
-                instBox->yMax() - 1));
-
-  std::vector<value> overlap_insts;
-  fixed_insts.query(bgi::intersects(box), std::back_inserter(overlap_insts));
+  const odb::Rect box(
+      instBox->xMin() - ((left_pad + right_pad) * site_width) + 1,
+      instBox->yMin() + 1,
+      instBox->xMax() + ((left_pad + right_pad) * site_width) - 1,
+      instBox->yMax() - 1);
+
+  // The diode must not overlap fixed instances or diodes inserted before it.
+  for (const odb::dbRegionQueryShape& shape :
+       block_->queryRegion(nullptr, box, odb::dbRegionQueryShape::INST)) {
+    odb::dbInst* inst = static_cast<odb::dbInst*>(shape.object);
+    if (inst == diode_inst) {
+      continue;
+    }
+    const odb::dbPlacementStatus status = inst->getPlacementStatus();
+    if (status == odb::dbPlacementStatus::FIRM
+        || status == odb::dbPlacementStatus::LOCKED
+        || (inst->getMaster() == diode_inst->getMaster()
+            && diode_inst_set_.find(inst) != diode_inst_set_.end())) {
+      return false;
+    }
+  }
 
-  return overlap_insts.empty() && core_area.contains(instBox->getBox());
+  return core_area.contains(instBox->getBox());
 }
 
 void RepairAntennas::computeHorizontalOffset(const int diode_width,
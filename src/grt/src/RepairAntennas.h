@@ -39,6 +39,7 @@
 #include <boost/geometry/index/rtree.hpp>
 #include <boost/iterator/function_output_iterator.hpp>
 #include <string>
+#include <unordered_set>
 
 #include "ant/AntennaChecker.hh"
 #include "dpl/Opendp.h"
@@ -117,35 +118,23 @@ class RepairAntennas
   double diffArea(odb::dbMTerm* mterm);
 
  private:
-  typedef int coord_type;
-  typedef bg::cs::cartesian coord_sys_type;
-  typedef bg::model::point<coord_type, 2, coord_sys_type> point;
-  typedef bg::model::box<point> box;
-  typedef std::pair<box, int> value;
-  typedef bgi::rtree<value, bgi::quadratic<8, 4>> r_tree;
-
   void insertDiode(odb::dbNet* net,
                    odb::dbMTerm* diode_mterm,
                    odb::dbITerm* sink_iterm,
                    int site_width,
-                   r_tree& fixed_insts,
                    odb::dbTechLayer* violation_layer);
-  void getFixedInstances(r_tree& fixed_insts);
   void setInstsPlacementStatus(odb::dbPlacementStatus placement_status);
   bool setDiodeLoc(odb::dbInst* diode_inst,
                    odb::dbITerm* gate,
                    int site_width,
-                   bool place_vertically,
-                   r_tree& fixed_insts);
+                   bool place_vertically);
   void getInstancePlacementData(odb::dbITerm* gate,
                                 int& inst_loc_x,
                                 int& inst_loc_y,
                                 int& inst_width,
                                 int& inst_height,
                                 odb::dbOrientType& inst_orient);
-  bool checkDiodeLoc(odb::dbInst* diode_inst,
-                     int site_width,
-                     r_tree& fixed_insts);
+  bool checkDiodeLoc(odb::dbInst* diode_inst, int site_width);
   void computeHorizontalOffset(int diode_width,
                                int inst_width,
                                int site_width,
@@ -191,6 +180,8 @@ class RepairAntennas
   utl::Logger* logger_;
   odb::dbBlock* block_;
   std::vector<odb::dbInst*> diode_insts_;
+  // Same diodes as diode_insts_, for membership tests.
+  std::unordered_set<odb::dbInst*> diode_inst_set_;
   AntennaViolations antenna_violations_;
   int unique_diode_index_;
   int illegal_diode_placement_count_;
@@ -30,7 +30,7 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
-#include "Rudy.h"
+#include "grt/Rudy.h"
 
 #include "grt/GRoute.h"
 #include "grt/GlobalRouter.h"
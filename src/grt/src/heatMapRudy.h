@@ -33,8 +33,8 @@
 #pragma once
 
 #include "AbstractRoutingCongestionDataSource.h"
-#include "Rudy.h"
 #include "grt/GlobalRouter.h"
+#include "grt/Rudy.h"
 #include "gui/heatMap.h"
 #include "odb/dbBlockCallBackObj.h"
 #include "odb/util.h"
@@ -0,0 +1,28 @@
+# global_route gives the guides of congestion1 with 1, 2 and 4 threads on a
+# design that overflows, so the congestion iterations run the threaded maze
+# routing
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set_global_routing_layer_adjustment metal2 0.9
+set_global_routing_layer_adjustment metal3 0.9
+set_global_routing_layer_adjustment metal4-metal10 1
+
+set_routing_layers -signal metal2-metal10
+
+foreach threads {1 2 4} {
+  set guide_file [make_result_file congestion_threads_$threads.guide]
+  set_thread_count $threads
+  global_route -allow_congestion -verbose
+  write_guides $guide_file
+  set guides($threads) $guide_file
+}
+
+foreach threads {1 2 4} {
+  if { [diff_files congestion1.guideok $guides($threads)] } {
+    exit 1
+  }
+}
+puts "pass"
+exit
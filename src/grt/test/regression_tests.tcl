@@ -66,3 +66,7 @@ record_tests {
   #grt_man_tcl_check
   #grt_readme_msgs_check
 }
+
+record_pass_fail_tests {
+  congestion_threads
+}
@@ -378,16 +378,41 @@ class dbDatabase : public dbObject
 
   ///
   /// Read a database from this stream.
+  /// The tables of each block are deserialized on num_threads threads.
   /// WARNING: This function destroys the data currently in the database.
   /// Throws ZIOError..
   ///
-  void read(std::istream& f);
+  void read(std::istream& f, int num_threads = 1);
+
+  ///
+  /// Read a database from a file that is mapped into memory instead of
+  /// streamed. The wires, guides, properties and parasitics of each block
+  /// are only deserialized when they are first accessed, which makes
+  /// opening a large database for reporting much faster.
+  /// The file must not be modified while the database is in use; call
+  /// loadSections() first to be able to overwrite it.
+  /// WARNING: This function destroys the data currently in the database.
+  ///
+  void readMapped(const char* file_name, int num_threads = 1);
+
+  ///
+  /// Deserialize all the data that readMapped deferred.
+  /// A deferred section is read under a lock on first access, so reading
+  /// the database from several threads is safe, but the first access
+  /// stalls every other thread that needs the section.  Call this before
+  /// entering a parallel region that reads the database.
+  ///
+  void loadSections();
 
   ///
   /// Write a database to this stream.
+  /// The tables of each block are serialized on num_threads threads and
+  /// compressed with zlib if compress is set.
+  /// Any section that readMapped deferred is loaded first. If the stream
+  /// overwrites the mapped file, call loadSections() before opening it.
   /// Throws ZIOError..
   ///
-  void write(std::ostream& file);
+  void write(std::ostream& file, int num_threads = 1, bool compress = false);
 
   ///
   /// ECO - The following methods implement a simple ECO mechanism for capturing
@@ -860,6 +885,30 @@ class dbChip : public dbObject
   static void destroy(dbChip* chip);
 };
 
+///////////////////////////////////////////////////////////////////////////////
+///
+/// A shape reported by dbBlock::queryRegion.
+///
+///////////////////////////////////////////////////////////////////////////////
+struct dbRegionQueryShape
+{
+  enum Type
+  {
+    INST = 0x01,         // instance bounding box (object is a dbInst)
+    WIRE = 0x02,         // routed wire segment or via (object is a dbNet)
+    SWIRE = 0x04,        // special wire box (object is a dbSBox)
+    BPIN = 0x08,         // block pin box (object is a dbBPin)
+    OBSTRUCTION = 0x10,  // routing obstruction (object is a dbObstruction)
+    BLOCKAGE = 0x20,     // placement blockage (object is a dbBlockage)
+    ALL = 0x3f
+  };
+
+  Type type;
+  Rect box;
+  dbTechLayer* layer;  // nullptr for instances and placement blockages
+  dbObject* object;
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 ///
 /// A Block is the element used to represent a layout-netlist.
@@ -1031,6 +1080,19 @@ class dbBlock : public dbObject
   ///
   dbInst* findInst(const char* name);
 
+  ///
+  /// Find the instances of this block whose name starts with prefix.
+  /// They are appended to insts in name order.  The names are sorted on
+  /// the first call after an instance is created, destroyed or renamed.
+  ///
+  void findInstsByPrefix(const char* prefix, std::vector<dbInst*>& insts);
+
+  ///
+  /// Size the instance and net name tables for the given number of
+  /// objects, so that creating them in bulk does not rehash repeatedly.
+  ///
+  void reserveNames(uint inst_count, uint net_count);
+
   ///
   /// Find a specific module in this block.
   /// Returns nullptr if the object was not found.
@@ -1112,6 +1174,31 @@ class dbBlock : public dbObject
   ///
   dbSet<dbBlockage> getBlockages();
 
+  ///
+  /// Get the shapes of this block that intersect rect.
+  /// If layer is not null only the shapes on that layer are reported;
+  /// instances and placement blockages have no layer and are reported
+  /// regardless. filter is a mask of dbRegionQueryShape::Type values.
+  /// Only placed instances are reported.
+  ///
+  /// The spatial index is built on first use and kept up to date through
+  /// the block callbacks, so repeated queries do not rescan the block.
+  /// Until it is released every edit of an indexed shape also updates it.
+  ///
+  /// Several threads may query at once while the block is not edited;
+  /// building the index on first use is serialized.
+  ///
+  std::vector<dbRegionQueryShape> queryRegion(
+      dbTechLayer* layer,
+      const Rect& rect,
+      uint filter = dbRegionQueryShape::ALL);
+
+  ///
+  /// Release the spatial index used by queryRegion. It is rebuilt by the
+  /// next query. Must not be called while another thread queries.
+  ///
+  void releaseRegionQuery();
+
   ///
   /// Get the nets of this block
   ///
@@ -1133,6 +1220,13 @@ class dbBlock : public dbObject
   ///
   dbNet* findNet(const char* name);
 
+  ///
+  /// Find the nets of this block whose name starts with prefix.
+  /// They are appended to nets in name order.  The names are sorted on
+  /// the first call after a net is created, destroyed or renamed.
+  ///
+  void findNetsByPrefix(const char* prefix, std::vector<dbNet*>& nets);
+
   ///
   /// Find a set of nets. Each name can be real name, or Nxxx, or xxx,
   /// where xxx is the net oid.
@@ -36,6 +36,7 @@
 #include <cstdint>
 #include <cstring>
 #include <istream>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <unordered_map>
@@ -51,6 +52,7 @@
 namespace odb {
 
 class _dbDatabase;
+class dbMappedFile;
 
 inline constexpr size_t kTemplateRecursionLimit = 16;
 
@@ -68,6 +70,8 @@ class dbOStream
   double _lef_area_factor;
   double _lef_dist_factor;
   std::vector<Scope> _scopes;
+  int _threads;
+  bool _compress;
 
   // By default values are written as their string ("255" vs 0xFF)
   // representations when using the << stream method. In dbOstream we are
@@ -80,6 +84,8 @@ class dbOStream
 
  public:
   dbOStream(_dbDatabase* db, std::ostream& f);
+  // Stream to f with the settings of parent.
+  dbOStream(const dbOStream& parent, std::ostream& f);
 
   _dbDatabase* getDatabase() { return _db; }
 
@@ -269,9 +275,20 @@ class dbOStream
   double lefdist(int value) { return ((double) value * _lef_dist_factor); }
 
   Position pos() const { return _f.tellp(); }
+  void seek(Position pos) { _f.seekp(pos); }
 
   void pushScope(const std::string& name);
   void popScope();
+
+  void writeBytes(const char* data, size_t size) { _f.write(data, size); }
+
+  // Number of threads used to serialize the sections of a block.
+  void setThreads(int threads) { _threads = threads; }
+  int getThreads() const { return _threads; }
+
+  // Compress the sections of a block with zlib.
+  void setCompress(bool compress) { _compress = compress; }
+  bool getCompress() const { return _compress; }
 };
 
 // RAII class for scoping ostream operations
@@ -293,11 +310,16 @@ class dbIStream
 {
   std::istream& _f;
   _dbDatabase* _db;
+  std::shared_ptr<dbMappedFile> _mapped_file;
   double _lef_area_factor;
   double _lef_dist_factor;
+  int _threads;
+  uint _schema_minor;
 
  public:
   dbIStream(_dbDatabase* db, std::istream& f);
+  // Stream from f with the settings of parent.
+  dbIStream(const dbIStream& parent, std::istream& f);
 
   _dbDatabase* getDatabase() { return _db; }
 
@@ -490,6 +512,32 @@ class dbIStream
 
   double lefdist(int value) { return ((double) value * _lef_dist_factor); }
 
+  std::istream::pos_type pos() { return _f.tellg(); }
+  void skip(uint64_t bytes) { _f.seekg(bytes, std::ios::cur); }
+  void readBytes(char* data, size_t size) { _f.read(data, size); }
+
+  // Number of threads used to deserialize the sections of a block.
+  void setThreads(int threads) { _threads = threads; }
+  int getThreads() const { return _threads; }
+
+  // The file this stream reads from when it is mapped into memory.
+  // Sections are only deferred when this is set.
+  const std::shared_ptr<dbMappedFile>& getMappedFile() const
+  {
+    return _mapped_file;
+  }
+  void setMappedFile(std::shared_ptr<dbMappedFile> file)
+  {
+    _mapped_file = std::move(file);
+  }
+
+  // Revision of the data being read.  Readers check it rather than the
+  // database, which is moved to the current revision once the eager part
+  // of a read is done while deferred sections are still at the file's.
+  uint getSchemaMinor() const { return _schema_minor; }
+  void setSchemaMinor(uint schema_minor) { _schema_minor = schema_minor; }
+  bool isSchema(uint rev) const { return _schema_minor >= rev; }
+
  private:
   template <uint32_t I = 0, typename... Ts>
   dbIStream& variantHelper(uint32_t index, std::variant<Ts...>& v)
@@ -35,6 +35,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <string>
 
 #include "array1.h"
 #include "utl/Logger.h"
@@ -96,4 +97,7 @@ class Ath__parser
   utl::Logger* _logger;
 };
 
+// Quotes a file name for use in a shell command.
+std::string shellQuote(const char* name);
+
 }  // namespace odb
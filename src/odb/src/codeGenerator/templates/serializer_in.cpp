@@ -13,7 +13,7 @@
       {% else %}
         {% if 'no-serial' not in field.flags %}
           {% if 'schema' in field %}
-          if (obj.getDatabase()->isSchema({{field.schema}})) {
+          if (stream.isSchema({{field.schema}})) {
           {% endif %}
           stream >> {% if field.table %}*{% endif %}obj.{{field.name}};
           {% if 'schema' in field %}
@@ -279,8 +279,6 @@ dbOStream& operator<<(dbOStream& stream, const _dbBTerm& bterm)
 
 dbIStream& operator>>(dbIStream& stream, _dbBTerm& bterm)
 {
-  dbBlock* block = (dbBlock*) (bterm.getOwner());
-  _dbDatabase* db = (_dbDatabase*) (block->getDataBase());
   uint* bit_field = (uint*) &bterm._flags;
   stream >> *bit_field;
   stream >> bterm._ext_id;
@@ -289,7 +287,7 @@ dbIStream& operator>>(dbIStream& stream, _dbBTerm& bterm)
   stream >> bterm._net;
   stream >> bterm._next_bterm;
   stream >> bterm._prev_bterm;
-  if (db->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> bterm._mnet;
     stream >> bterm._next_modnet_bterm;
     stream >> bterm._prev_modnet_bterm;
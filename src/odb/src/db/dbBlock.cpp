@@ -35,8 +35,11 @@
 #include <errno.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 
@@ -79,6 +82,7 @@
 #include "dbIntHashTable.hpp"
 #include "dbIsolation.h"
 #include "dbJournal.h"
+#include "dbLazySection.h"
 #include "dbLevelShifter.h"
 #include "dbLogicPort.h"
 #include "dbModBTerm.h"
@@ -109,11 +113,13 @@
 #include "dbRegion.h"
 #include "dbRegionGroupItr.h"
 #include "dbRegionInstItr.h"
+#include "dbRegionQuery.h"
 #include "dbRow.h"
 #include "dbSBox.h"
 #include "dbSBoxItr.h"
 #include "dbSWire.h"
 #include "dbSWireItr.h"
+#include "dbSections.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "dbTech.h"
@@ -414,6 +420,7 @@ _dbBlock::_dbBlock(_dbDatabase* db)
 
   _num_ext_dbs = 1;
   _searchDb = nullptr;
+  _region_query = nullptr;
   _extmi = nullptr;
   _journal = nullptr;
   _journal_pending = nullptr;
@@ -460,6 +467,8 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
       _currentCcAdjOrder(block._currentCcAdjOrder),
       _dft(block._dft)
 {
+  block.loadSections();
+
   if (block._name) {
     _name = strdup(block._name);
     ZALLOCATED(_name);
@@ -619,6 +628,7 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
 
   // ??? Initialize search-db on copy?
   _searchDb = nullptr;
+  _region_query = nullptr;
 
   // ??? callbacks
   // _callbacks = ???
@@ -631,6 +641,10 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
 
 _dbBlock::~_dbBlock()
 {
+  // The spatial index is a block callback so it must go before the
+  // remaining callbacks are detached below.
+  delete _region_query;
+
   if (_name) {
     free((void*) _name);
   }
@@ -740,6 +754,10 @@ void dbBlock::clear()
   // save a copy of the delimeter
   char delimeter = block->_hier_delimeter;
 
+  // drop the spatial index; it is rebuilt on the next query
+  delete block->_region_query;
+  block->_region_query = nullptr;
+
   std::list<dbBlockCallBackObj*> callbacks;
 
   // save callbacks
@@ -929,8 +947,137 @@ dbObjectTable* _dbBlock::getObjectTable(dbObjectType type)
   return getTable()->getObjectTable(type);
 }
 
+// Stream a table as a section of its own.
+template <class T>
+static dbSection tableSection(const char* name, T* table)
+{
+  return {name,
+          {},
+          [table](dbOStream& stream) { stream << *table; },
+          [table](dbIStream& stream) { stream >> *table; }};
+}
+
+// The tables of a block in the order they are streamed.  Tables are written
+// at the current revision; the readers skip what older revisions lack.
+static std::vector<dbSection> blockSections(_dbBlock& block)
+{
+  return {
+      tableSection("bterm_tbl", block._bterm_tbl),
+      tableSection("iterm_tbl", block._iterm_tbl),
+      tableSection("net_tbl", block._net_tbl),
+      tableSection("inst_hdr_tbl", block._inst_hdr_tbl),
+      tableSection("inst_tbl", block._inst_tbl),
+      tableSection("module_tbl", block._module_tbl),
+      tableSection("modinst_tbl", block._modinst_tbl),
+      {"mod_tbls",
+       {},
+       [&block](dbOStream& s) {
+         s << *block._modbterm_tbl;
+         s << *block._moditerm_tbl;
+         s << *block._modnet_tbl;
+       },
+       [&block](dbIStream& s) {
+         if (s.isSchema(db_schema_update_hierarchy)) {
+           s >> *block._modbterm_tbl;
+           s >> *block._moditerm_tbl;
+           s >> *block._modnet_tbl;
+         }
+       }},
+      tableSection("powerdomain_tbl", block._powerdomain_tbl),
+      tableSection("logicport_tbl", block._logicport_tbl),
+      tableSection("powerswitch_tbl", block._powerswitch_tbl),
+      tableSection("isolation_tbl", block._isolation_tbl),
+      {"levelshifter_tbl",
+       {},
+       [&block](dbOStream& s) { s << *block._levelshifter_tbl; },
+       [&block](dbIStream& s) {
+         if (s.isSchema(db_schema_level_shifter)) {
+           s >> *block._levelshifter_tbl;
+         }
+       }},
+      tableSection("group_tbl", block._group_tbl),
+      tableSection("ap_tbl", block.ap_tbl_),
+      {"global_connect_tbl",
+       {},
+       [&block](dbOStream& s) { s << *block.global_connect_tbl_; },
+       [&block](dbIStream& s) {
+         if (s.isSchema(db_schema_add_global_connect)) {
+           s >> *block.global_connect_tbl_;
+         }
+       }},
+      {"guide_tbl",
+       {block._guide_tbl},
+       [&block](dbOStream& s) { s << *block._guide_tbl; },
+       [&block](dbIStream& s) { s >> *block._guide_tbl; }},
+      {"net_tracks_tbl",
+       {},
+       [&block](dbOStream& s) { s << *block._net_tracks_tbl; },
+       [&block](dbIStream& s) {
+         if (s.isSchema(db_schema_net_tracks)) {
+           s >> *block._net_tracks_tbl;
+         }
+       }},
+      tableSection("box_tbl", block._box_tbl),
+      tableSection("via_tbl", block._via_tbl),
+      tableSection("gcell_grid_tbl", block._gcell_grid_tbl),
+      tableSection("track_grid_tbl", block._track_grid_tbl),
+      tableSection("obstruction_tbl", block._obstruction_tbl),
+      tableSection("blockage_tbl", block._blockage_tbl),
+      {"wire_tbl",
+       {block._wire_tbl},
+       [&block](dbOStream& s) { s << *block._wire_tbl; },
+       [&block](dbIStream& s) { s >> *block._wire_tbl; }},
+      tableSection("swire_tbl", block._swire_tbl),
+      tableSection("sbox_tbl", block._sbox_tbl),
+      tableSection("row_tbl", block._row_tbl),
+      tableSection("fill_tbl", block._fill_tbl),
+      tableSection("region_tbl", block._region_tbl),
+      tableSection("hier_tbl", block._hier_tbl),
+      tableSection("bpin_tbl", block._bpin_tbl),
+      tableSection("non_default_rule_tbl", block._non_default_rule_tbl),
+      tableSection("layer_rule_tbl", block._layer_rule_tbl),
+      {"prop_tbl",
+       {block._prop_tbl},
+       [&block](dbOStream& s) { s << *block._prop_tbl; },
+       [&block](dbIStream& s) { s >> *block._prop_tbl; }},
+      tableSection("name_cache", block._name_cache),
+      {"parasitics",
+       {block._cap_node_tbl, block._r_seg_tbl, block._cc_seg_tbl},
+       [&block](dbOStream& s) {
+         s << *block._r_val_tbl;
+         s << *block._c_val_tbl;
+         s << *block._cc_val_tbl;
+         s << NamedTable("cap_node_tbl", block._cap_node_tbl);
+         s << NamedTable("r_seg_tbl", block._r_seg_tbl);
+         s << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
+       },
+       [&block](dbIStream& s) {
+         s >> *block._r_val_tbl;
+         s >> *block._c_val_tbl;
+         s >> *block._cc_val_tbl;
+         s >> *block._cap_node_tbl;  // DKF
+         s >> *block._r_seg_tbl;     // DKF
+         s >> *block._cc_seg_tbl;
+       }},
+      tableSection("ext_control", block._extControl),
+      {"dft",
+       {},
+       [&block](dbOStream& s) {
+         s << block._dft;
+         s << *block._dft_tbl;
+       },
+       [&block](dbIStream& s) {
+         if (s.isSchema(db_schema_add_scan)) {
+           s >> block._dft;
+           s >> *block._dft_tbl;
+         }
+       }},
+  };
+}
+
 dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
 {
+  block.loadSections();
   std::list<dbBlockCallBackObj*>::const_iterator cbitr;
   for (cbitr = block._callbacks.begin(); cbitr != block._callbacks.end();
        ++cbitr) {
@@ -982,56 +1129,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << block._component_mask_shift;
   stream << block._currentCcAdjOrder;
 
-  stream << *block._bterm_tbl;
-  stream << *block._iterm_tbl;
-  stream << *block._net_tbl;
-  stream << *block._inst_hdr_tbl;
-  stream << *block._inst_tbl;
-  stream << *block._module_tbl;
-  stream << *block._modinst_tbl;
-  if (db->isSchema(db_schema_update_hierarchy)) {
-    stream << *block._modbterm_tbl;
-    stream << *block._moditerm_tbl;
-    stream << *block._modnet_tbl;
-  }
-  stream << *block._powerdomain_tbl;
-  stream << *block._logicport_tbl;
-  stream << *block._powerswitch_tbl;
-  stream << *block._isolation_tbl;
-  stream << *block._levelshifter_tbl;
-  stream << *block._group_tbl;
-  stream << *block.ap_tbl_;
-  stream << *block.global_connect_tbl_;
-  stream << *block._guide_tbl;
-  stream << *block._net_tracks_tbl;
-  stream << *block._box_tbl;
-  stream << *block._via_tbl;
-  stream << *block._gcell_grid_tbl;
-  stream << *block._track_grid_tbl;
-  stream << *block._obstruction_tbl;
-  stream << *block._blockage_tbl;
-  stream << *block._wire_tbl;
-  stream << *block._swire_tbl;
-  stream << *block._sbox_tbl;
-  stream << *block._row_tbl;
-  stream << *block._fill_tbl;
-  stream << *block._region_tbl;
-  stream << *block._hier_tbl;
-  stream << *block._bpin_tbl;
-  stream << *block._non_default_rule_tbl;
-  stream << *block._layer_rule_tbl;
-  stream << *block._prop_tbl;
-
-  stream << *block._name_cache;
-  stream << *block._r_val_tbl;
-  stream << *block._c_val_tbl;
-  stream << *block._cc_val_tbl;
-  stream << NamedTable("cap_node_tbl", block._cap_node_tbl);
-  stream << NamedTable("r_seg_tbl", block._r_seg_tbl);
-  stream << NamedTable("cc_seg_tbl", block._cc_seg_tbl);
-  stream << *block._extControl;
-  stream << block._dft;
-  stream << *block._dft_tbl;
+  writeSections(stream, blockSections(const_cast<_dbBlock&>(block)));
 
   //---------------------------------------------------------- stream out
   // properties
@@ -1052,7 +1150,6 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
 
 dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
 {
-  _dbDatabase* db = block.getImpl()->getDatabase();
 
   stream >> block._def_units;
   stream >> block._dbu_per_micron;
@@ -1066,7 +1163,7 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> block._die_area;
   // In the older schema we can't set the tech here, we handle this later in
   // dbDatabase.
-  if (db->isSchema(db_schema_block_tech)) {
+  if (stream.isSchema(db_schema_block_tech)) {
     stream >> block._tech;
   }
   stream >> block._chip;
@@ -1081,7 +1178,7 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> block._inst_hash;
   stream >> block._module_hash;
   stream >> block._modinst_hash;
-  if (db->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> block._modbterm_hash;
     stream >> block._moditerm_hash;
     stream >> block._modnet_hash;
@@ -1090,7 +1187,7 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> block._logicport_hash;
   stream >> block._powerswitch_hash;
   stream >> block._isolation_hash;
-  if (db->isSchema(db_schema_level_shifter)) {
+  if (stream.isSchema(db_schema_level_shifter)) {
     stream >> block._levelshifter_hash;
   }
   stream >> block._group_hash;
@@ -1099,73 +1196,24 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> block._maxCapNodeId;
   stream >> block._maxRSegId;
   stream >> block._maxCCSegId;
-  if (!db->isSchema(db_schema_block_ext_model_index)) {
+  if (!stream.isSchema(db_schema_block_ext_model_index)) {
     int ignore_minExtModelIndex;
     int ignore_maxExtModelIndex;
     stream >> ignore_minExtModelIndex;
     stream >> ignore_maxExtModelIndex;
   }
   stream >> block._children;
-  if (db->isSchema(db_schema_block_component_mask_shift)) {
+  if (stream.isSchema(db_schema_block_component_mask_shift)) {
     stream >> block._component_mask_shift;
   }
   stream >> block._currentCcAdjOrder;
-  stream >> *block._bterm_tbl;
-  stream >> *block._iterm_tbl;
-  stream >> *block._net_tbl;
-  stream >> *block._inst_hdr_tbl;
-  stream >> *block._inst_tbl;
-  stream >> *block._module_tbl;
-  stream >> *block._modinst_tbl;
-  if (db->isSchema(db_schema_update_hierarchy)) {
-    stream >> *block._modbterm_tbl;
-    stream >> *block._moditerm_tbl;
-    stream >> *block._modnet_tbl;
-  }
-  stream >> *block._powerdomain_tbl;
-  stream >> *block._logicport_tbl;
-  stream >> *block._powerswitch_tbl;
-  stream >> *block._isolation_tbl;
-  if (db->isSchema(db_schema_level_shifter)) {
-    stream >> *block._levelshifter_tbl;
-  }
-  stream >> *block._group_tbl;
-  stream >> *block.ap_tbl_;
-  if (db->isSchema(db_schema_add_global_connect)) {
-    stream >> *block.global_connect_tbl_;
-  }
-  stream >> *block._guide_tbl;
-  if (db->isSchema(db_schema_net_tracks)) {
-    stream >> *block._net_tracks_tbl;
-  }
-  stream >> *block._box_tbl;
-  stream >> *block._via_tbl;
-  stream >> *block._gcell_grid_tbl;
-  stream >> *block._track_grid_tbl;
-  stream >> *block._obstruction_tbl;
-  stream >> *block._blockage_tbl;
-  stream >> *block._wire_tbl;
-  stream >> *block._swire_tbl;
-  stream >> *block._sbox_tbl;
-  stream >> *block._row_tbl;
-  stream >> *block._fill_tbl;
-  stream >> *block._region_tbl;
-  stream >> *block._hier_tbl;
-  stream >> *block._bpin_tbl;
-  stream >> *block._non_default_rule_tbl;
-  stream >> *block._layer_rule_tbl;
-  stream >> *block._prop_tbl;
-  stream >> *block._name_cache;
-  stream >> *block._r_val_tbl;
-  stream >> *block._c_val_tbl;
-  stream >> *block._cc_val_tbl;
-  stream >> *block._cap_node_tbl;  // DKF
-  stream >> *block._r_seg_tbl;     // DKF
-  stream >> *block._cc_seg_tbl;
-  stream >> *block._extControl;
-  if (db->isSchema(db_schema_add_scan)) {
-    stream >> block._dft;
-    stream >> *block._dft_tbl;
+  const std::vector<dbSection> sections = blockSections(block);
+  if (stream.isSchema(db_schema_parallel_sections)) {
+    readSections(stream, sections, block._lazy_sections);
+  } else {
+    for (const dbSection& section : sections) {
+      section.read(stream);
+    }
   }
 
   //---------------------------------------------------------- stream in
@@ -1187,6 +1235,13 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   return stream;
 }
 
+void _dbBlock::loadSections() const
+{
+  for (const auto& section : _lazy_sections) {
+    section->load();
+  }
+}
+
 void _dbBlock::add_rect(const Rect& rect)
 {
   _dbBox* box = _box_tbl->getPtr(_bbox);
@@ -1215,6 +1270,8 @@ void _dbBlock::remove_rect(const Rect& rect)
 
 bool _dbBlock::operator==(const _dbBlock& rhs) const
 {
+  loadSections();
+  rhs.loadSections();
   if (_flags._valid_bbox != rhs._flags._valid_bbox) {
     return false;
   }
@@ -1551,6 +1608,8 @@ void _dbBlock::differences(dbDiff& diff,
                            const char* field,
                            const _dbBlock& rhs) const
 {
+  loadSections();
+  rhs.loadSections();
   DIFF_BEGIN
   DIFF_FIELD(_flags._valid_bbox);
   DIFF_FIELD(_def_units);
@@ -1652,6 +1711,7 @@ void _dbBlock::differences(dbDiff& diff,
 
 void _dbBlock::out(dbDiff& diff, char side, const char* field) const
 {
+  loadSections();
   DIFF_OUT_BEGIN
   DIFF_OUT_FIELD(_flags._valid_bbox);
   DIFF_OUT_FIELD(_def_units);
@@ -2033,6 +2093,53 @@ dbInst* dbBlock::findInst(const char* name)
   return (dbInst*) block->_inst_hash.find(name);
 }
 
+// Appends the objects of sorted, which is in name order, whose name
+// starts with prefix.
+template <class T, class S>
+static void findByPrefix(const std::vector<T*>& sorted,
+                         const char* prefix,
+                         std::vector<S*>& objs)
+{
+  const size_t len = strlen(prefix);
+  auto it = std::lower_bound(
+      sorted.begin(), sorted.end(), prefix, [](const T* obj, const char* name) {
+        return strcmp(obj->_name, name) < 0;
+      });
+  for (; it != sorted.end() && strncmp((*it)->_name, prefix, len) == 0; ++it) {
+    objs.push_back((S*) *it);
+  }
+}
+
+template <class T, class S>
+static void sortByName(dbSet<S> objs, std::vector<T*>& sorted)
+{
+  sorted.clear();
+  sorted.reserve(objs.size());
+  for (S* obj : objs) {
+    sorted.push_back((T*) obj);
+  }
+  std::sort(sorted.begin(), sorted.end(), [](const T* a, const T* b) {
+    return strcmp(a->_name, b->_name) < 0;
+  });
+}
+
+void dbBlock::reserveNames(uint inst_count, uint net_count)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  block->_inst_hash.reserve(inst_count);
+  block->_net_hash.reserve(net_count);
+}
+
+void dbBlock::findInstsByPrefix(const char* prefix, std::vector<dbInst*>& insts)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  if (!block->_sorted_insts_valid) {
+    sortByName(getInsts(), block->_sorted_insts);
+    block->_sorted_insts_valid = true;
+  }
+  findByPrefix(block->_sorted_insts, prefix, insts);
+}
+
 dbModule* dbBlock::findModule(const char* name)
 {
   _dbBlock* block = (_dbBlock*) this;
@@ -2129,6 +2236,32 @@ dbSet<dbBlockage> dbBlock::getBlockages()
   return dbSet<dbBlockage>(block, block->_blockage_tbl);
 }
 
+std::vector<dbRegionQueryShape> dbBlock::queryRegion(dbTechLayer* layer,
+                                                     const Rect& rect,
+                                                     uint filter)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  dbRegionQuery* region_query;
+  {
+    std::lock_guard<std::mutex> lock(block->_region_query_mutex);
+    if (block->_region_query == nullptr) {
+      block->_region_query = new dbRegionQuery(block);
+    }
+    region_query = block->_region_query;
+  }
+  std::vector<dbRegionQueryShape> shapes;
+  region_query->query(layer, rect, filter, shapes);
+  return shapes;
+}
+
+void dbBlock::releaseRegionQuery()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  std::lock_guard<std::mutex> lock(block->_region_query_mutex);
+  delete block->_region_query;
+  block->_region_query = nullptr;
+}
+
 dbSet<dbNet> dbBlock::getNets()
 {
   _dbBlock* block = (_dbBlock*) this;
@@ -2147,6 +2280,16 @@ dbNet* dbBlock::findNet(const char* name)
   return (dbNet*) block->_net_hash.find(name);
 }
 
+void dbBlock::findNetsByPrefix(const char* prefix, std::vector<dbNet*>& nets)
+{
+  _dbBlock* block = (_dbBlock*) this;
+  if (!block->_sorted_nets_valid) {
+    sortByName(getNets(), block->_sorted_nets);
+    block->_sorted_nets_valid = true;
+  }
+  findByPrefix(block->_sorted_nets, prefix, nets);
+}
+
 bool dbBlock::findSomeMaster(const char* names, std::vector<dbMaster*>& masters)
 {
   if (!names || names[0] == '\0') {
@@ -2515,6 +2658,7 @@ void dbBlock::copyExtDb(uint fr,
                         double gndcFactor)
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->loadSections();
   uint j;
   if (resFactor != 1.0) {
     for (j = 1; j < block->_r_val_tbl->size(); j += extDbCnt) {
@@ -2614,6 +2758,7 @@ void dbBlock::undoAdjustedCC(std::vector<dbNet*>& nets,
 void dbBlock::adjustRC(double resFactor, double ccFactor, double gndcFactor)
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->loadSections();
   uint j;
   if (resFactor != 1.0) {
     for (j = 1; j < block->_r_val_tbl->size(); j++) {
@@ -33,11 +33,14 @@
 #pragma once
 
 #include <list>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "dbCore.h"
 #include "dbHashTable.h"
 #include "dbIntHashTable.h"
+#include "dbLazySection.h"
 #include "dbPagedVector.h"
 #include "dbVector.h"
 #include "odb/dbTransform.h"
@@ -133,6 +136,7 @@ class dbIStream;
 class dbOStream;
 class dbDiff;
 class dbBlockSearch;
+class dbRegionQuery;
 class dbBlockCallBackObj;
 class dbGuideItr;
 class dbNetTrackItr;
@@ -282,6 +286,18 @@ class _dbBlock : public _dbObject
   dbBPinItr* _bpin_itr;
   dbPropertyItr* _prop_itr;
   dbBlockSearch* _searchDb;
+  dbRegionQuery* _region_query;
+  // Serializes the lazy creation and release of _region_query.
+  std::mutex _region_query_mutex;
+  // Sections of a mapped database file that have not been read yet.
+  std::vector<std::unique_ptr<dbLazySection>> _lazy_sections;
+  // Nets and instances in name order for prefix lookups.  They are
+  // rebuilt on the next lookup after a net or instance is created,
+  // destroyed or renamed.
+  std::vector<_dbNet*> _sorted_nets;
+  std::vector<_dbInst*> _sorted_insts;
+  bool _sorted_nets_valid = false;
+  bool _sorted_insts_valid = false;
 
   unsigned char _num_ext_dbs;
 
@@ -298,6 +314,10 @@ class _dbBlock : public _dbObject
   void add_oct(const Oct& oct);
   void remove_rect(const Rect& rect);
   void invalidate_bbox() { _flags._valid_bbox = 0; }
+  void invalidateNetNames() { _sorted_nets_valid = false; }
+  void invalidateInstNames() { _sorted_insts_valid = false; }
+  // Read all sections still pending from a mapped database file.
+  void loadSections() const;
   void initialize(_dbChip* chip,
                   _dbTech* tech,
                   _dbBlock* parent,
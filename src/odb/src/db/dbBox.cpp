@@ -45,6 +45,7 @@
 #include "dbNet.h"
 #include "dbObstruction.h"
 #include "dbRegion.h"
+#include "dbRegionQuery.h"
 #include "dbSWire.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
@@ -842,6 +843,9 @@ dbBox* dbBox::create(dbBPin* bpin_,
   bpin->_boxes = box->getOID();
 
   block->add_rect(box->_shape._rect);
+  if (block->_region_query) {
+    block->_region_query->invalidateBPins();
+  }
   return (dbBox*) box;
 }
 
@@ -192,10 +192,10 @@ inline dbOStream& operator<<(dbOStream& stream, const _dbBox& box)
 
 inline dbIStream& operator>>(dbIStream& stream, _dbBox& box)
 {
-  if (box.getDatabase()->isSchema(db_schema_dbbox_mask)) {
+  if (stream.isSchema(db_schema_dbbox_mask)) {
     uint* bit_field = (uint*) &box._flags;
     stream >> *bit_field;
-  } else if (box.getDatabase()->isSchema(db_schema_box_layer_bits)) {
+  } else if (stream.isSchema(db_schema_box_layer_bits)) {
     _dbBoxFlagsWithoutMask old;
     uint* bit_field = (uint*) &old;
     stream >> *bit_field;
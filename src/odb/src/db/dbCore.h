@@ -44,6 +44,8 @@
 ///  dbTablePage
 ///
 
+#include <atomic>
+
 #include "dbAttrTable.h"
 #include "odb/dbId.h"
 #include "odb/dbObject.h"
@@ -55,6 +57,7 @@ namespace odb {
 
 class _dbDatabase;
 class _dbProperty;
+class dbLazySection;
 class dbObjectTable;
 
 #define DB_ALLOC_BIT 0x80000000
@@ -97,6 +100,10 @@ class dbObjectTable
   dbObjectType _type;
   uint _obj_size;
   dbObjectTable* (dbObject::*_getObjectTable)(dbObjectType type);
+  // Set while the table belongs to a section of a mapped file that has not
+  // been read yet (see dbLazySection).  Cleared with release semantics once
+  // the section is read so that readers on other threads see the tables.
+  std::atomic<dbLazySection*> _lazy_section;
 
   // PERSISTANT DATA
   dbAttrTable<dbId<_dbProperty>> _prop_list;
@@ -122,6 +129,18 @@ class dbObjectTable
   {
     return (_owner->*_getObjectTable)(type);
   }
+
+  // Read the pending section of this table, if any.
+  void ensureLoaded() const
+  {
+    dbLazySection* section = _lazy_section.load(std::memory_order_acquire);
+    if (section) {
+      loadLazySection(section);
+    }
+  }
+
+ private:
+  static void loadLazySection(dbLazySection* section);
 };
 
 ///////////////////////////////////////////////////////////////
@@ -156,6 +175,7 @@ inline dbObjectTable::dbObjectTable()
 {
   _db = nullptr;
   _owner = nullptr;
+  _lazy_section.store(nullptr, std::memory_order_relaxed);
 }
 
 inline dbObjectTable::dbObjectTable(_dbDatabase* db,
@@ -168,6 +188,7 @@ inline dbObjectTable::dbObjectTable(_dbDatabase* db,
   _owner = owner;
   _getObjectTable = m;
   _type = type;
+  _lazy_section.store(nullptr, std::memory_order_relaxed);
 
   // Objects must be greater than 16-bytes
   assert(size >= sizeof(_dbFreeObject));
@@ -46,6 +46,7 @@
 #include "dbITerm.h"
 #include "dbJournal.h"
 #include "dbLib.h"
+#include "dbMappedFile.h"
 #include "dbNameCache.h"
 #include "dbNet.h"
 #include "dbProperty.h"
@@ -307,6 +308,7 @@ dbIStream& operator>>(dbIStream& stream, _dbDatabase& db)
   }
 
   stream >> db._schema_minor;
+  stream.setSchemaMinor(db._schema_minor);
 
   if (db._schema_minor < db_schema_initial) {
     throw ZException("incompatible database schema revision");
@@ -325,7 +327,7 @@ dbIStream& operator>>(dbIStream& stream, _dbDatabase& db)
   stream >> db._chip;
 
   dbId<_dbTech> old_db_tech;
-  if (!db.isSchema(db_schema_block_tech)) {
+  if (!stream.isSchema(db_schema_block_tech)) {
     stream >> old_db_tech;
   }
   stream >> *db._tech_tbl;
@@ -335,7 +337,7 @@ dbIStream& operator>>(dbIStream& stream, _dbDatabase& db)
   stream >> *db._name_cache;
 
   // Set the _tech on the block & libs now they are loaded
-  if (!db.isSchema(db_schema_block_tech)) {
+  if (!stream.isSchema(db_schema_block_tech)) {
     if (db._chip) {
       _dbChip* chip = db._chip_tbl->getPtr(db._chip);
       if (chip->_top) {
@@ -467,17 +469,44 @@ dbTech* dbDatabase::getTech()
       utl::ODB, 432, "getTech() is obsolete in a multi-tech db");
 }
 
-void dbDatabase::read(std::istream& file)
+void dbDatabase::read(std::istream& file, int num_threads)
 {
   _dbDatabase* db = (_dbDatabase*) this;
   dbIStream stream(db, file);
+  stream.setThreads(num_threads);
   stream >> *db;
 }
 
-void dbDatabase::write(std::ostream& file)
+void dbDatabase::readMapped(const char* file_name, int num_threads)
 {
+  _dbDatabase* db = (_dbDatabase*) this;
+  auto file = std::make_shared<dbMappedFile>(file_name);
+  dbMemoryStreamBuf buffer(file->data(), file->size());
+  std::istream is(&buffer);
+  is.exceptions(std::ios::failbit | std::ios::badbit | std::ios::eofbit);
+  dbIStream stream(db, is);
+  stream.setMappedFile(file);
+  stream.setThreads(num_threads);
+  stream >> *db;
+}
+
+void dbDatabase::loadSections()
+{
+  for (dbChip* chip : getChips()) {
+    _dbChip* chip_impl = (_dbChip*) chip;
+    for (dbBlock* block : dbSet<dbBlock>(chip, chip_impl->_block_tbl)) {
+      ((_dbBlock*) block)->loadSections();
+    }
+  }
+}
+
+void dbDatabase::write(std::ostream& file, int num_threads, bool compress)
+{
+  loadSections();
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
+  stream.setThreads(num_threads);
+  stream.setCompress(compress);
   stream << *db;
   file.flush();
 }
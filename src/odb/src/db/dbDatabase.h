@@ -45,11 +45,13 @@ namespace odb {
 
 //
 // When changing the database schema please add a #define to refer to the schema
-// changes. Use the define statement along with the isSchema(rev) method:
+// changes. Use the define statement along with the isSchema(rev) method.
+// Readers check the revision of the stream they read from, as sections
+// of a mapped file may be read after the database has been upgraded:
 //
 // GOOD:
 //
-//    if ( db->isSchema(db_schema_initial) )
+//    if ( stream.isSchema(db_schema_initial) )
 //    {
 //     ....
 //    }
@@ -70,7 +72,11 @@ namespace odb {
 const uint db_schema_major = 0;  // Not used...
 const uint db_schema_initial = 57;
 
-const uint db_schema_minor = 84;  // Current revision number
+const uint db_schema_minor = 85;  // Current revision number
+
+// Revision where the tables of a block are written as separately framed,
+// optionally compressed sections that are read in parallel or on demand
+const uint db_schema_parallel_sections = 85;
 
 // Revision where GRT layer adjustment was relocated to dbTechLayer
 const uint db_schema_layer_adjustment = 84;
@@ -170,8 +170,7 @@ dbIStream& operator>>(dbIStream& stream, _dbGCellGrid& obj)
   stream >> obj.x_grid_;
   stream >> obj.y_grid_;
   // User Code Begin >>
-  _dbDatabase* db = obj.getDatabase();
-  if (db->isSchema(db_schema_gcell_grid_matrix)) {
+  if (stream.isSchema(db_schema_gcell_grid_matrix)) {
     stream >> obj.congestion_map_;
   } else {
     std::map<dbId<_dbTechLayer>,
@@ -218,7 +217,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbGCellGrid& obj)
 
 dbIStream& operator>>(dbIStream& stream, dbGCellGrid::GCellData& obj)
 {
-  if (stream.getDatabase()->isSchema(db_schema_smaler_gcelldata)) {
+  if (stream.isSchema(db_schema_smaler_gcelldata)) {
     stream >> obj.usage;
     stream >> obj.capacity;
   } else {
@@ -68,6 +68,9 @@ class dbHashTable
 
   // NON-PERSISTANT-MEMBERS
   dbTable<T>* _obj_tbl;
+  // Entry count given to reserve; remove does not shrink the table until
+  // it is reached.
+  uint _reserved;
 
   void growTable();
   void shrinkTable();
@@ -87,6 +90,9 @@ class dbHashTable
   int hasMember(const char* name);
   void insert(T* object);
   void remove(T* object);
+  // Grow the table to hold count entries without further rehashing.
+  // Removes do not shrink it again until count entries were inserted.
+  void reserve(uint count);
 };
 
 template <class T>
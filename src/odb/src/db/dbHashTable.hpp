@@ -54,11 +54,15 @@ dbHashTable<T>::dbHashTable()
 {
   _obj_tbl = nullptr;
   _num_entries = 0;
+  _reserved = 0;
 }
 
 template <class T>
 dbHashTable<T>::dbHashTable(const dbHashTable<T>& t)
-    : _hash_tbl(t._hash_tbl), _num_entries(t._num_entries), _obj_tbl(t._obj_tbl)
+    : _hash_tbl(t._hash_tbl),
+      _num_entries(t._num_entries),
+      _obj_tbl(t._obj_tbl),
+      _reserved(t._reserved)
 {
 }
 
@@ -173,6 +177,9 @@ template <class T>
 void dbHashTable<T>::insert(T* object)
 {
   ++_num_entries;
+  if (_num_entries >= _reserved) {
+    _reserved = 0;
+  }
   uint sz = _hash_tbl.size();
 
   if (sz == 0) {
@@ -194,6 +201,22 @@ void dbHashTable<T>::insert(T* object)
   e = object->getOID();
 }
 
+template <class T>
+void dbHashTable<T>::reserve(uint count)
+{
+  if (_hash_tbl.size() == 0) {
+    dbId<T> nullId;
+    _hash_tbl.push_back(nullId);
+  }
+
+  while (count / _hash_tbl.size() > CHAIN_LENGTH) {
+    growTable();
+  }
+  if (count > _num_entries) {
+    _reserved = count;
+  }
+}
+
 template <class T>
 T* dbHashTable<T>::find(const char* name)
 {
@@ -267,7 +290,7 @@ void dbHashTable<T>::remove(T* object)
 
       uint r = (_num_entries + _num_entries / 10) / sz;
 
-      if ((r < (CHAIN_LENGTH >> 1)) && (sz > 1)) {
+      if ((r < (CHAIN_LENGTH >> 1)) && (sz > 1) && (_reserved == 0)) {
         shrinkTable();
       }
 
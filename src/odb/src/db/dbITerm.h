@@ -148,8 +148,6 @@ inline dbOStream& operator<<(dbOStream& stream, const _dbITerm& iterm)
 
 inline dbIStream& operator>>(dbIStream& stream, _dbITerm& iterm)
 {
-  dbBlock* block = (dbBlock*) (iterm.getOwner());
-  _dbDatabase* db = (_dbDatabase*) (block->getDataBase());
   uint* bit_field = (uint*) &iterm._flags;
   stream >> *bit_field;
   stream >> iterm._ext_id;
@@ -157,7 +155,7 @@ inline dbIStream& operator>>(dbIStream& stream, _dbITerm& iterm)
   stream >> iterm._inst;
   stream >> iterm._next_net_iterm;
   stream >> iterm._prev_net_iterm;
-  if (db->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> iterm._mnet;
     stream >> iterm._next_modnet_iterm;
     stream >> iterm._prev_modnet_iterm;
@@ -489,6 +489,7 @@ bool dbInst::rename(const char* name)
   inst->_name = strdup(name);
   ZALLOCATED(inst->_name);
   block->_inst_hash.insert(inst);
+  block->invalidateInstNames();
 
   return true;
 }
@@ -1426,6 +1427,7 @@ dbInst* dbInst::create(dbBlock* block_,
   ZALLOCATED(inst->_name);
   inst->_inst_hdr = inst_hdr->getOID();
   block->_inst_hash.insert(inst);
+  block->invalidateInstNames();
   inst_hdr->_inst_cnt++;
 
   // create the iterms
@@ -1628,6 +1630,7 @@ void dbInst::destroy(dbInst* inst_)
   _dbBox* box = block->_box_tbl->getPtr(inst->_bbox);
   block->remove_rect(box->_shape._rect);
   block->_inst_hash.remove(inst);
+  block->invalidateInstNames();
   dbProperty::destroyProperties(inst);
   block->_inst_tbl->destroy(inst);
   dbProperty::destroyProperties(box);
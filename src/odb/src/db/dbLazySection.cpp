@@ -0,0 +1,114 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbLazySection.h"
+
+#include <istream>
+
+#include "dbCore.h"
+#include "dbDatabase.h"
+#include "dbMappedFile.h"
+#include "odb/dbStream.h"
+
+namespace odb {
+
+dbLazySection::dbLazySection(_dbDatabase* db,
+                             uint schema_minor,
+                             std::shared_ptr<dbMappedFile> file,
+                             uint64_t offset,
+                             uint64_t size,
+                             dbSectionCodec codec,
+                             uint64_t raw_size,
+                             std::vector<dbObjectTable*> tables,
+                             Reader reader)
+    : db_(db),
+      file_(std::move(file)),
+      offset_(offset),
+      size_(size),
+      codec_(codec),
+      raw_size_(raw_size),
+      schema_minor_(schema_minor),
+      tables_(std::move(tables)),
+      reader_(std::move(reader)),
+      loaded_(false),
+      loading_(false)
+{
+  for (dbObjectTable* table : tables_) {
+    table->_lazy_section.store(this, std::memory_order_release);
+  }
+}
+
+void dbLazySection::load()
+{
+  if (loaded_.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  // Streaming one table of the section may touch another table of the same
+  // section on this thread; it is being filled in already.
+  if (loaded_.load(std::memory_order_relaxed) || loading_) {
+    return;
+  }
+  loading_ = true;
+
+  try {
+    readSection(codec_,
+                file_->data() + offset_,
+                size_,
+                raw_size_,
+                [this](std::istream& file) {
+                  dbIStream stream(db_, file);
+                  stream.setSchemaMinor(schema_minor_);
+                  reader_(stream);
+                });
+  } catch (...) {
+    loading_ = false;
+    throw;
+  }
+
+  // Only now let other threads past the check in ensureLoaded().
+  for (dbObjectTable* table : tables_) {
+    table->_lazy_section.store(nullptr, std::memory_order_release);
+  }
+  file_.reset();
+  reader_ = nullptr;
+  loading_ = false;
+  loaded_.store(true, std::memory_order_release);
+}
+
+void dbObjectTable::loadLazySection(dbLazySection* section)
+{
+  section->load();
+}
+
+}  // namespace odb
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "dbSections.h"
+#include "odb/odb.h"
+
+namespace odb {
+
+class _dbDatabase;
+class dbIStream;
+class dbMappedFile;
+class dbObjectTable;
+
+//
+// A group of tables that was skipped while reading a mapped database file.
+// The tables keep a pointer to the section and the first access to any of
+// them deserializes the whole section from the mapping.
+//
+class dbLazySection
+{
+ public:
+  using Reader = std::function<void(dbIStream&)>;
+
+  dbLazySection(_dbDatabase* db,
+                uint schema_minor,
+                std::shared_ptr<dbMappedFile> file,
+                uint64_t offset,
+                uint64_t size,
+                dbSectionCodec codec,
+                uint64_t raw_size,
+                std::vector<dbObjectTable*> tables,
+                Reader reader);
+
+  // Read the section if that has not been done yet.  Concurrent callers
+  // wait until the first one has finished reading.
+  void load();
+  bool isLoaded() const { return loaded_.load(std::memory_order_acquire); }
+
+ private:
+  _dbDatabase* db_;
+  std::shared_ptr<dbMappedFile> file_;
+  uint64_t offset_;
+  uint64_t size_;
+  dbSectionCodec codec_;
+  uint64_t raw_size_;
+  // Revision of the file; the database is moved to the current revision
+  // once the eager part of the read is done, so the section's stream is
+  // given this one.
+  uint schema_minor_;
+  std::vector<dbObjectTable*> tables_;
+  Reader reader_;
+
+  std::recursive_mutex mutex_;
+  std::atomic<bool> loaded_;
+  bool loading_;
+};
+
+}  // namespace odb
@@ -235,7 +235,7 @@ dbIStream& operator>>(dbIStream& stream, _dbLevelShifter& obj)
   stream >> obj._name_suffix;
   stream >> obj._instances;
   // User Code Begin >>
-  if (stream.getDatabase()->isSchema(db_schema_level_shifter_cell)) {
+  if (stream.isSchema(db_schema_level_shifter_cell)) {
     stream >> obj._cell_name;
     stream >> obj._cell_input;
     stream >> obj._cell_output;
@@ -267,7 +267,7 @@ dbIStream& operator>>(dbIStream& stream, _dbLib& lib)
   stream >> lib._site_hash;
   // In the older schema we can't set the tech here, we handle this later in
   // dbDatabase.
-  if (lib.getDatabase()->isSchema(db_schema_block_tech)) {
+  if (stream.isSchema(db_schema_block_tech)) {
     stream >> lib._tech;
   }
   stream >> *lib._master_tbl;
@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbMappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "odb/ZException.h"
+
+namespace odb {
+
+dbMappedFile::dbMappedFile(const char* file_name) : data_(nullptr), size_(0)
+{
+  const int fd = open(file_name, O_RDONLY);
+  if (fd < 0) {
+    throw ZException("Can not open %s: %s", file_name, strerror(errno));
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    const int err = errno;
+    close(fd);
+    throw ZException("Can not stat %s: %s", file_name, strerror(err));
+  }
+  size_ = info.st_size;
+
+  if (size_ > 0) {
+    void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (addr == MAP_FAILED) {
+      const int err = errno;
+      close(fd);
+      throw ZException("Can not map %s: %s", file_name, strerror(err));
+    }
+    data_ = static_cast<const char*>(addr);
+  }
+
+  // The mapping stays valid after the descriptor is closed.
+  close(fd);
+}
+
+dbMappedFile::~dbMappedFile()
+{
+  if (data_) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+dbMemoryStreamBuf::dbMemoryStreamBuf(const char* data, size_t size)
+{
+  char* begin = const_cast<char*>(data);
+  setg(begin, begin, begin + size);
+}
+
+dbMemoryStreamBuf::pos_type dbMemoryStreamBuf::seekoff(
+    off_type off,
+    std::ios_base::seekdir dir,
+    std::ios_base::openmode which)
+{
+  if ((which & std::ios_base::in) == 0) {
+    return pos_type(off_type(-1));
+  }
+
+  off_type base;
+  if (dir == std::ios_base::beg) {
+    base = 0;
+  } else if (dir == std::ios_base::cur) {
+    base = gptr() - eback();
+  } else {
+    base = egptr() - eback();
+  }
+
+  const off_type target = base + off;
+  if (target < 0 || target > egptr() - eback()) {
+    return pos_type(off_type(-1));
+  }
+  setg(eback(), eback() + target, egptr());
+  return pos_type(target);
+}
+
+dbMemoryStreamBuf::pos_type dbMemoryStreamBuf::seekpos(
+    pos_type pos,
+    std::ios_base::openmode which)
+{
+  return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+std::streamsize dbMemoryStreamBuf::xsgetn(char_type* s, std::streamsize count)
+{
+  const std::streamsize n = std::min<std::streamsize>(count, egptr() - gptr());
+  std::memcpy(s, gptr(), n);
+  setg(eback(), gptr() + n, egptr());
+  return n;
+}
+
+}  // namespace odb
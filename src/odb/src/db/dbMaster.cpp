@@ -381,8 +381,7 @@ dbIStream& operator>>(dbIStream& stream, _dbMaster& master)
   stream >> master._leq;
   stream >> master._eeq;
   stream >> master._obstructions;
-  _dbDatabase* db = master.getImpl()->getDatabase();
-  if (db->isSchema(db_schema_dbmaster_lib_for_site)) {
+  if (stream.isSchema(db_schema_dbmaster_lib_for_site)) {
     stream >> master._lib_for_site;
   } else {
     // The site was copied into the same dbLib previously
@@ -132,28 +132,28 @@ _dbModBTerm::_dbModBTerm(_dbDatabase* db, const _dbModBTerm& r)
 
 dbIStream& operator>>(dbIStream& stream, _dbModBTerm& obj)
 {
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._name;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._flags;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._parent_moditerm;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._parent;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._modnet;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._next_net_modbterm;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._prev_net_modbterm;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._next_entry;
   }
   return stream;
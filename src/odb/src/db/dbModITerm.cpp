@@ -125,25 +125,25 @@ _dbModITerm::_dbModITerm(_dbDatabase* db, const _dbModITerm& r)
 
 dbIStream& operator>>(dbIStream& stream, _dbModITerm& obj)
 {
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._name;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._parent;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._child_modbterm;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._mod_net;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._next_net_moditerm;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._prev_net_moditerm;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._next_entry;
   }
   return stream;
@@ -134,25 +134,25 @@ _dbModNet::_dbModNet(_dbDatabase* db, const _dbModNet& r)
 
 dbIStream& operator>>(dbIStream& stream, _dbModNet& obj)
 {
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._name;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._parent;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._next_entry;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._moditerms;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._modbterms;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._iterms;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._bterms;
   }
   return stream;
@@ -150,10 +150,10 @@ dbIStream& operator>>(dbIStream& stream, _dbModule& obj)
   stream >> obj._insts;
   stream >> obj._mod_inst;
   stream >> obj._modinsts;
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._modnets;
   }
-  if (obj.getDatabase()->isSchema(db_schema_update_hierarchy)) {
+  if (stream.isSchema(db_schema_update_hierarchy)) {
     stream >> obj._modbterms;
   }
   return stream;
@@ -197,14 +197,21 @@ dbIStream& operator>>(dbIStream& stream, _dbNet& net)
   stream >> net._ccAdjustOrder;
   stream >> net._groups;
   stream >> net.guides_;
-  _dbDatabase* db = net.getImpl()->getDatabase();
-  if (db->isSchema(db_schema_net_tracks)) {
+  if (stream.isSchema(db_schema_net_tracks)) {
     stream >> net.tracks_;
   }
 
   return stream;
 }
 
+void _dbNet::markWireAltered()
+{
+  // A net without RC segments is extracted again anyway.
+  if (_r_segs != 0) {
+    _flags._wire_altered = 1;
+  }
+}
+
 bool _dbNet::operator<(const _dbNet& rhs) const
 {
   return strcmp(_name, rhs._name) < 0;
@@ -722,6 +729,7 @@ bool dbNet::rename(const char* name)
   net->_name = strdup(name);
   ZALLOCATED(net->_name);
   block->_net_hash.insert(net);
+  block->invalidateNetNames();
 
   return true;
 }
@@ -3092,6 +3100,7 @@ dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
   net->_name = strdup(name_);
   ZALLOCATED(net->_name);
   block->_net_hash.insert(net);
+  block->invalidateNetNames();
 
   std::list<dbBlockCallBackObj*>::iterator cbitr;
   for (cbitr = block->_callbacks.begin(); cbitr != block->_callbacks.end();
@@ -3171,6 +3180,7 @@ void dbNet::destroy(dbNet* net_)
 
   dbProperty::destroyProperties(net);
   block->_net_hash.remove(net);
+  block->invalidateNetNames();
   block->_net_tbl->destroy(net);
 }
 
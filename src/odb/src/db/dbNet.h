@@ -140,6 +140,8 @@ class _dbNet : public _dbObject
   void differences(dbDiff& diff, const char* field, const _dbNet& rhs) const;
   void out(dbDiff& diff, char side, const char* field) const;
   dbObjectTable* getObjectTable(dbObjectType type);
+  // Flag the parasitics of an extracted net as stale after a wire edit.
+  void markWireAltered();
 };
 
 dbOStream& operator<<(dbOStream& stream, const _dbNet& net);
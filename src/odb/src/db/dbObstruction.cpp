@@ -94,8 +94,7 @@ dbIStream& operator>>(dbIStream& stream, _dbObstruction& obs)
   stream >> obs._min_spacing;
   stream >> obs._effective_width;
 
-  _dbDatabase* db = obs.getImpl()->getDatabase();
-  if (!db->isSchema(db_schema_except_pg_nets_obstruction)) {
+  if (!stream.isSchema(db_schema_except_pg_nets_obstruction)) {
     // assume false for older databases
     obs._flags._except_pg_nets = false;
   }
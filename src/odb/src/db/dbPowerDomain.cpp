@@ -169,11 +169,11 @@ dbIStream& operator>>(dbIStream& stream, _dbPowerDomain& obj)
   stream >> obj._y1;
   stream >> obj._y2;
   // User Code Begin >>
-  if (stream.getDatabase()->isSchema(db_schema_level_shifter)) {
+  if (stream.isSchema(db_schema_level_shifter)) {
     stream >> obj._levelshifters;
   }
 
-  if (stream.getDatabase()->isSchema(db_schema_power_domain_voltage)) {
+  if (stream.isSchema(db_schema_power_domain_voltage)) {
     stream >> obj._voltage;
   }
   // User Code End >>
@@ -144,7 +144,7 @@ dbIStream& operator>>(dbIStream& stream, _dbPowerSwitch& obj)
   stream >> obj._name;
   stream >> obj._next_entry;
   // User Code Begin >>
-  if (obj.getDatabase()->isSchema(db_schema_update_db_power_switch)) {
+  if (stream.isSchema(db_schema_update_db_power_switch)) {
     stream >> obj._in_supply_port;
     stream >> obj._out_supply_port;
     stream >> obj._control_port;
@@ -177,7 +177,7 @@ dbIStream& operator>>(dbIStream& stream, _dbPowerSwitch& obj)
     stream >> net;  // unused
   }
   stream >> obj._power_domain;
-  if (obj.getDatabase()->isSchema(db_schema_upf_power_switch_mapping)) {
+  if (stream.isSchema(db_schema_upf_power_switch_mapping)) {
     stream >> obj._lib_cell;
     stream >> obj._lib;
     stream >> obj._port_map;
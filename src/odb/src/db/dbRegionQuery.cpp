@@ -0,0 +1,451 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbRegionQuery.h"
+
+#include "dbBlock.h"
+#include "dbWire.h"
+#include "odb/dbShape.h"
+
+namespace odb {
+
+dbRegionQuery::dbRegionQuery(_dbBlock* block) : block_(block), built_(0)
+{
+  addOwner((dbBlock*) block);
+}
+
+dbRegionQueryShape::Type dbRegionQuery::categoryType(Category category)
+{
+  // The categories are listed in the same order as the Type bits.
+  return static_cast<dbRegionQueryShape::Type>(1 << category);
+}
+
+bool dbRegionQuery::isBuilt(Category category) const
+{
+  return (built_ & categoryType(category)) != 0;
+}
+
+void dbRegionQuery::invalidate(Category category)
+{
+  trees_[category].clear();
+  built_.fetch_and(~categoryType(category));
+  if (category == kInst) {
+    inst_boxes_.clear();
+  } else if (category == kWire) {
+    wire_values_.clear();
+  }
+}
+
+void dbRegionQuery::invalidateBPins()
+{
+  invalidate(kBPin);
+}
+
+void dbRegionQuery::build(Category category)
+{
+  invalidate(category);
+
+  LayerValues values;
+  switch (category) {
+    case kInst:
+      collectInsts(values);
+      break;
+    case kWire:
+      collectWires(values);
+      break;
+    case kSWire:
+      collectSWires(values);
+      break;
+    case kBPin:
+      collectBPins(values);
+      break;
+    case kObstruction:
+      collectObstructions(values);
+      break;
+    case kBlockage:
+      collectBlockages(values);
+      break;
+    case kNumCategories:
+      break;
+  }
+
+  // Bulk load each layer with the packing algorithm.
+  LayerTrees& trees = trees_[category];
+  for (auto& [layer, layer_values] : values) {
+    trees.emplace(layer, RTree(layer_values.begin(), layer_values.end()));
+  }
+  built_.fetch_or(categoryType(category));
+}
+
+void dbRegionQuery::collectInsts(LayerValues& values)
+{
+  std::vector<Value>& insts = values[nullptr];
+  for (dbInst* inst : ((dbBlock*) block_)->getInsts()) {
+    const Rect box = inst->getBBox()->getBox();
+    insts.emplace_back(box, inst);
+    inst_boxes_[inst->getId()] = box;
+  }
+}
+
+void dbRegionQuery::collectWires(LayerValues& values)
+{
+  for (dbNet* net : ((dbBlock*) block_)->getNets()) {
+    dbWire* wire = net->getWire();
+    if (wire == nullptr) {
+      continue;
+    }
+    std::vector<LayerValue>& wire_values = wire_values_[wire->getId()];
+    getWireValues(wire, wire_values);
+    for (const auto& [layer, value] : wire_values) {
+      values[layer].push_back(value);
+    }
+  }
+}
+
+void dbRegionQuery::collectSWires(LayerValues& values)
+{
+  std::vector<LayerValue> box_values;
+  for (dbNet* net : ((dbBlock*) block_)->getNets()) {
+    for (dbSWire* swire : net->getSWires()) {
+      for (dbSBox* box : swire->getWires()) {
+        box_values.clear();
+        getSBoxValues(box, box_values);
+        for (const auto& [layer, value] : box_values) {
+          values[layer].push_back(value);
+        }
+      }
+    }
+  }
+}
+
+void dbRegionQuery::collectBPins(LayerValues& values)
+{
+  for (dbBTerm* bterm : ((dbBlock*) block_)->getBTerms()) {
+    for (dbBPin* bpin : bterm->getBPins()) {
+      for (dbBox* box : bpin->getBoxes()) {
+        values[box->getTechLayer()].emplace_back(box->getBox(), bpin);
+      }
+    }
+  }
+}
+
+void dbRegionQuery::collectObstructions(LayerValues& values)
+{
+  for (dbObstruction* obstruction : ((dbBlock*) block_)->getObstructions()) {
+    dbBox* box = obstruction->getBBox();
+    values[box->getTechLayer()].emplace_back(box->getBox(), obstruction);
+  }
+}
+
+void dbRegionQuery::collectBlockages(LayerValues& values)
+{
+  std::vector<Value>& blockages = values[nullptr];
+  for (dbBlockage* blockage : ((dbBlock*) block_)->getBlockages()) {
+    blockages.emplace_back(blockage->getBBox()->getBox(), blockage);
+  }
+}
+
+void dbRegionQuery::getWireValues(dbWire* wire,
+                                  std::vector<LayerValue>& values)
+{
+  dbNet* net = wire->getNet();
+  if (net == nullptr) {
+    return;
+  }
+
+  dbWireShapeItr itr;
+  dbShape shape;
+  std::vector<dbShape> via_boxes;
+  for (itr.begin(wire); itr.next(shape);) {
+    if (shape.isVia()) {
+      dbShape::getViaBoxes(shape, via_boxes);
+      for (const dbShape& via_box : via_boxes) {
+        values.emplace_back(via_box.getTechLayer(),
+                            Value(via_box.getBox(), net));
+      }
+    } else {
+      values.emplace_back(shape.getTechLayer(), Value(shape.getBox(), net));
+    }
+  }
+}
+
+void dbRegionQuery::getSBoxValues(dbSBox* box,
+                                  std::vector<LayerValue>& values)
+{
+  if (box->isVia()) {
+    std::vector<dbShape> via_boxes;
+    box->getViaBoxes(via_boxes);
+    for (const dbShape& via_box : via_boxes) {
+      values.emplace_back(via_box.getTechLayer(), Value(via_box.getBox(), box));
+    }
+  } else {
+    values.emplace_back(box->getTechLayer(), Value(box->getBox(), box));
+  }
+}
+
+void dbRegionQuery::query(dbTechLayer* layer,
+                          const Rect& rect,
+                          uint filter,
+                          std::vector<dbRegionQueryShape>& shapes)
+{
+  for (int i = 0; i < kNumCategories; i++) {
+    const Category category = static_cast<Category>(i);
+    if ((filter & categoryType(category)) == 0) {
+      continue;
+    }
+    if (!isBuilt(category)) {
+      std::lock_guard<std::mutex> lock(build_mutex_);
+      if (!isBuilt(category)) {
+        build(category);
+      }
+    }
+
+    const LayerTrees& trees = trees_[category];
+    if (category == kInst || category == kBlockage) {
+      auto it = trees.find(nullptr);
+      if (it != trees.end()) {
+        queryTree(it->second, category, nullptr, rect, shapes);
+      }
+    } else if (layer == nullptr) {
+      for (const auto& [tree_layer, tree] : trees) {
+        queryTree(tree, category, tree_layer, rect, shapes);
+      }
+    } else {
+      auto it = trees.find(layer);
+      if (it != trees.end()) {
+        queryTree(it->second, category, layer, rect, shapes);
+      }
+    }
+  }
+}
+
+void dbRegionQuery::queryTree(const RTree& tree,
+                              Category category,
+                              dbTechLayer* layer,
+                              const Rect& rect,
+                              std::vector<dbRegionQueryShape>& shapes) const
+{
+  const dbRegionQueryShape::Type type = categoryType(category);
+  for (auto it = tree.qbegin(boost::geometry::index::intersects(rect));
+       it != tree.qend();
+       ++it) {
+    const auto& [box, object] = *it;
+    if (category == kInst
+        && !static_cast<dbInst*>(object)->getPlacementStatus().isPlaced()) {
+      continue;
+    }
+    shapes.push_back({type, box, layer, object});
+  }
+}
+
+void dbRegionQuery::insertInst(dbInst* inst)
+{
+  if (!isBuilt(kInst)) {
+    return;
+  }
+  const Rect box = inst->getBBox()->getBox();
+  trees_[kInst][nullptr].insert(Value(box, inst));
+  inst_boxes_[inst->getId()] = box;
+}
+
+void dbRegionQuery::removeInst(dbInst* inst)
+{
+  if (!isBuilt(kInst)) {
+    return;
+  }
+  auto it = inst_boxes_.find(inst->getId());
+  if (it == inst_boxes_.end()) {
+    return;
+  }
+  trees_[kInst][nullptr].remove(Value(it->second, inst));
+  inst_boxes_.erase(it);
+}
+
+void dbRegionQuery::insertWire(dbWire* wire)
+{
+  // only the routed wire of a net is indexed, as in collectWires
+  if (!isBuilt(kWire) || ((_dbWire*) wire)->_flags._is_global) {
+    return;
+  }
+  std::vector<LayerValue>& wire_values = wire_values_[wire->getId()];
+  getWireValues(wire, wire_values);
+  LayerTrees& trees = trees_[kWire];
+  for (const auto& [layer, value] : wire_values) {
+    trees[layer].insert(value);
+  }
+}
+
+void dbRegionQuery::removeWire(dbWire* wire)
+{
+  if (!isBuilt(kWire)) {
+    return;
+  }
+  auto it = wire_values_.find(wire->getId());
+  if (it == wire_values_.end()) {
+    return;
+  }
+  LayerTrees& trees = trees_[kWire];
+  for (const auto& [layer, value] : it->second) {
+    trees[layer].remove(value);
+  }
+  wire_values_.erase(it);
+}
+
+void dbRegionQuery::inDbInstCreate(dbInst* inst)
+{
+  insertInst(inst);
+}
+
+void dbRegionQuery::inDbInstCreate(dbInst* inst, dbRegion* /* region */)
+{
+  insertInst(inst);
+}
+
+void dbRegionQuery::inDbInstDestroy(dbInst* inst)
+{
+  removeInst(inst);
+}
+
+void dbRegionQuery::inDbInstSwapMasterAfter(dbInst* inst)
+{
+  removeInst(inst);
+  insertInst(inst);
+}
+
+void dbRegionQuery::inDbPreMoveInst(dbInst* inst)
+{
+  removeInst(inst);
+}
+
+void dbRegionQuery::inDbPostMoveInst(dbInst* inst)
+{
+  insertInst(inst);
+}
+
+void dbRegionQuery::inDbBPinCreate(dbBPin* /* bpin */)
+{
+  invalidate(kBPin);
+}
+
+void dbRegionQuery::inDbBPinDestroy(dbBPin* /* bpin */)
+{
+  invalidate(kBPin);
+}
+
+void dbRegionQuery::inDbBlockageCreate(dbBlockage* /* blockage */)
+{
+  invalidate(kBlockage);
+}
+
+void dbRegionQuery::inDbObstructionCreate(dbObstruction* /* obstruction */)
+{
+  invalidate(kObstruction);
+}
+
+void dbRegionQuery::inDbObstructionDestroy(dbObstruction* /* obstruction */)
+{
+  invalidate(kObstruction);
+}
+
+void dbRegionQuery::inDbWireCreate(dbWire* wire)
+{
+  insertWire(wire);
+}
+
+void dbRegionQuery::inDbWireDestroy(dbWire* wire)
+{
+  removeWire(wire);
+}
+
+void dbRegionQuery::inDbWirePostModify(dbWire* wire)
+{
+  removeWire(wire);
+  insertWire(wire);
+}
+
+void dbRegionQuery::inDbWirePostAttach(dbWire* wire)
+{
+  removeWire(wire);
+  insertWire(wire);
+}
+
+void dbRegionQuery::inDbWirePreDetach(dbWire* wire)
+{
+  removeWire(wire);
+}
+
+void dbRegionQuery::inDbWirePostAppend(dbWire* /* src */, dbWire* dst)
+{
+  removeWire(dst);
+  insertWire(dst);
+}
+
+void dbRegionQuery::inDbWirePostCopy(dbWire* /* src */, dbWire* dst)
+{
+  removeWire(dst);
+  insertWire(dst);
+}
+
+void dbRegionQuery::inDbSWireAddSBox(dbSBox* box)
+{
+  if (!isBuilt(kSWire)) {
+    return;
+  }
+  std::vector<LayerValue> values;
+  getSBoxValues(box, values);
+  LayerTrees& trees = trees_[kSWire];
+  for (const auto& [layer, value] : values) {
+    trees[layer].insert(value);
+  }
+}
+
+void dbRegionQuery::inDbSWireRemoveSBox(dbSBox* box)
+{
+  if (!isBuilt(kSWire)) {
+    return;
+  }
+  std::vector<LayerValue> values;
+  getSBoxValues(box, values);
+  LayerTrees& trees = trees_[kSWire];
+  for (const auto& [layer, value] : values) {
+    trees[layer].remove(value);
+  }
+}
+
+void dbRegionQuery::inDbSWirePreDestroySBoxes(dbSWire* wire)
+{
+  for (dbSBox* box : wire->getWires()) {
+    inDbSWireRemoveSBox(box);
+  }
+}
+
+}  // namespace odb
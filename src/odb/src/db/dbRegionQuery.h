@@ -0,0 +1,156 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <boost/geometry/index/rtree.hpp>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbBlockCallBackObj.h"
+#include "odb/geom.h"
+#include "odb/geom_boost.h"
+
+namespace odb {
+
+class _dbBlock;
+
+//
+// Spatial index over the shapes of a block backing dbBlock::queryRegion.
+//
+// Each shape category is indexed lazily on the first query that asks for
+// it. Instances, wires and special wires are then updated incrementally
+// from the block callbacks; pins, obstructions and blockages are few enough
+// that any change simply drops their index so it is rebuilt on next use.
+//
+// Queries may run concurrently as long as the block is not being edited;
+// the lazy build of a category is serialized by build_mutex_.
+//
+class dbRegionQuery : public dbBlockCallBackObj
+{
+ public:
+  explicit dbRegionQuery(_dbBlock* block);
+
+  void query(dbTechLayer* layer,
+             const Rect& rect,
+             uint filter,
+             std::vector<dbRegionQueryShape>& shapes);
+
+  // Pin boxes are added after the pin is created without a callback.
+  void invalidateBPins();
+
+  // dbBlockCallBackObj
+  void inDbInstCreate(dbInst* inst) override;
+  void inDbInstCreate(dbInst* inst, dbRegion* region) override;
+  void inDbInstDestroy(dbInst* inst) override;
+  void inDbInstSwapMasterAfter(dbInst* inst) override;
+  void inDbPreMoveInst(dbInst* inst) override;
+  void inDbPostMoveInst(dbInst* inst) override;
+  void inDbBPinCreate(dbBPin* bpin) override;
+  void inDbBPinDestroy(dbBPin* bpin) override;
+  void inDbBlockageCreate(dbBlockage* blockage) override;
+  void inDbObstructionCreate(dbObstruction* obstruction) override;
+  void inDbObstructionDestroy(dbObstruction* obstruction) override;
+  void inDbWireCreate(dbWire* wire) override;
+  void inDbWireDestroy(dbWire* wire) override;
+  void inDbWirePostModify(dbWire* wire) override;
+  void inDbWirePostAttach(dbWire* wire) override;
+  void inDbWirePreDetach(dbWire* wire) override;
+  void inDbWirePostAppend(dbWire* src, dbWire* dst) override;
+  void inDbWirePostCopy(dbWire* src, dbWire* dst) override;
+  void inDbSWireAddSBox(dbSBox* box) override;
+  void inDbSWireRemoveSBox(dbSBox* box) override;
+  void inDbSWirePreDestroySBoxes(dbSWire* wire) override;
+
+ private:
+  using Value = std::pair<Rect, dbObject*>;
+  using RTree
+      = boost::geometry::index::rtree<Value,
+                                      boost::geometry::index::quadratic<16>>;
+  // Instances and placement blockages are stored under the nullptr layer.
+  using LayerTrees = std::map<dbTechLayer*, RTree>;
+  using LayerValues = std::map<dbTechLayer*, std::vector<Value>>;
+
+  enum Category
+  {
+    kInst,
+    kWire,
+    kSWire,
+    kBPin,
+    kObstruction,
+    kBlockage,
+    kNumCategories
+  };
+
+  static dbRegionQueryShape::Type categoryType(Category category);
+  bool isBuilt(Category category) const;
+  void build(Category category);
+  void invalidate(Category category);
+
+  void collectInsts(LayerValues& values);
+  void collectWires(LayerValues& values);
+  void collectSWires(LayerValues& values);
+  void collectBPins(LayerValues& values);
+  void collectObstructions(LayerValues& values);
+  void collectBlockages(LayerValues& values);
+
+  void insertInst(dbInst* inst);
+  void removeInst(dbInst* inst);
+  void insertWire(dbWire* wire);
+  void removeWire(dbWire* wire);
+  using LayerValue = std::pair<dbTechLayer*, Value>;
+  static void getWireValues(dbWire* wire, std::vector<LayerValue>& values);
+  static void getSBoxValues(dbSBox* box, std::vector<LayerValue>& values);
+
+  void queryTree(const RTree& tree,
+                 Category category,
+                 dbTechLayer* layer,
+                 const Rect& rect,
+                 std::vector<dbRegionQueryShape>& shapes) const;
+
+  _dbBlock* block_;
+  std::atomic<uint> built_;
+  std::mutex build_mutex_;
+  std::array<LayerTrees, kNumCategories> trees_;
+  // Shapes last inserted per instance / wire id so they can be removed
+  // after the object has changed.
+  std::unordered_map<uint, Rect> inst_boxes_;
+  std::unordered_map<uint, std::vector<LayerValue>> wire_values_;
+};
+
+}  // namespace odb
@@ -0,0 +1,526 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbSections.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+
+#include "dbDatabase.h"
+#include "dbLazySection.h"
+#include "dbMappedFile.h"
+#include "odb/ZException.h"
+#include "odb/dbStream.h"
+#include "utl/exception.h"
+
+namespace odb {
+
+// Collects the bytes of a section a chunk at a time and passes them on to
+// sink, deflated if compressing, so that a section is never held in full.
+// Checkpoints are written often; favor speed over ratio.
+class dbSectionWriteBuf : public std::streambuf
+{
+ public:
+  using Sink = std::function<void(const char* data, size_t size)>;
+
+  dbSectionWriteBuf(bool compress, Sink sink);
+  ~dbSectionWriteBuf() override;
+
+  // Flush the last chunk and return the raw and stored sizes.
+  void finish(uint64_t& raw_size, uint64_t& stored_size);
+
+ protected:
+  int_type overflow(int_type ch) override;
+
+ private:
+  void flushChunk(int flush);
+
+  static constexpr size_t chunk_size = 1 << 20;
+
+  const bool compress_;
+  const Sink sink_;
+  std::vector<char> chunk_;
+  std::vector<char> deflated_;
+  uint64_t raw_size_ = 0;
+  uint64_t stored_size_ = 0;
+  z_stream zstream_{};
+};
+
+dbSectionWriteBuf::dbSectionWriteBuf(bool compress, Sink sink)
+    : compress_(compress), sink_(std::move(sink)), chunk_(chunk_size)
+{
+  if (compress_) {
+    const int status = deflateInit(&zstream_, Z_BEST_SPEED);
+    if (status != Z_OK) {
+      throw ZException("Can not compress database section: zlib error %d",
+                       status);
+    }
+    deflated_.resize(chunk_size);
+  }
+  setp(chunk_.data(), chunk_.data() + chunk_.size());
+}
+
+dbSectionWriteBuf::~dbSectionWriteBuf()
+{
+  if (compress_) {
+    deflateEnd(&zstream_);
+  }
+}
+
+dbSectionWriteBuf::int_type dbSectionWriteBuf::overflow(int_type ch)
+{
+  flushChunk(Z_NO_FLUSH);
+  if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+  }
+  return traits_type::not_eof(ch);
+}
+
+void dbSectionWriteBuf::flushChunk(int flush)
+{
+  const size_t size = pptr() - pbase();
+  raw_size_ += size;
+  if (!compress_) {
+    sink_(pbase(), size);
+    stored_size_ += size;
+  } else {
+    zstream_.next_in = reinterpret_cast<Bytef*>(pbase());
+    zstream_.avail_in = size;
+    int status;
+    do {
+      zstream_.next_out = reinterpret_cast<Bytef*>(deflated_.data());
+      zstream_.avail_out = deflated_.size();
+      status = deflate(&zstream_, flush);
+      if (status == Z_STREAM_ERROR) {
+        throw ZException("Can not compress database section: zlib error %d",
+                         status);
+      }
+      const size_t deflated_size = deflated_.size() - zstream_.avail_out;
+      sink_(deflated_.data(), deflated_size);
+      stored_size_ += deflated_size;
+    } while (zstream_.avail_out == 0
+             || (flush == Z_FINISH && status != Z_STREAM_END));
+  }
+  setp(chunk_.data(), chunk_.data() + chunk_.size());
+}
+
+void dbSectionWriteBuf::finish(uint64_t& raw_size, uint64_t& stored_size)
+{
+  flushChunk(compress_ ? Z_FINISH : Z_NO_FLUSH);
+  raw_size = raw_size_;
+  stored_size = stored_size_;
+}
+
+// Hands the raw bytes of a stored section to its reader a chunk at a time,
+// inflating them if needed.  The stored bytes are taken from memory or, if
+// data is null, read from source.
+class dbSectionReadBuf : public std::streambuf
+{
+ public:
+  dbSectionReadBuf(dbSectionCodec codec,
+                   const char* data,
+                   dbIStream* source,
+                   uint64_t size,
+                   uint64_t raw_size);
+  ~dbSectionReadBuf() override;
+
+  // Consume the stored bytes the reader did not need and check the sizes.
+  void finish();
+
+ protected:
+  int_type underflow() override;
+
+ private:
+  // Return the next chunk of stored bytes.
+  const char* nextStored(size_t& size);
+  [[noreturn]] void corrupt(int status) const;
+
+  static constexpr size_t chunk_size = 1 << 20;
+
+  const dbSectionCodec codec_;
+  const char* data_;
+  dbIStream* source_;
+  uint64_t remaining_;
+  const uint64_t raw_size_;
+  uint64_t raw_read_ = 0;
+  bool stream_end_ = false;
+  std::vector<char> input_;
+  std::vector<char> output_;
+  z_stream zstream_{};
+};
+
+dbSectionReadBuf::dbSectionReadBuf(dbSectionCodec codec,
+                                   const char* data,
+                                   dbIStream* source,
+                                   uint64_t size,
+                                   uint64_t raw_size)
+    : codec_(codec),
+      data_(data),
+      source_(source),
+      remaining_(size),
+      raw_size_(raw_size)
+{
+  if (codec_ == dbSectionCodec::ZLIB) {
+    const int status = inflateInit(&zstream_);
+    if (status != Z_OK) {
+      corrupt(status);
+    }
+    output_.resize(chunk_size);
+  } else if (codec_ != dbSectionCodec::NONE) {
+    throw ZException("Unknown database section codec %d", (int) codec_);
+  }
+  if (data_ == nullptr) {
+    input_.resize(std::min<uint64_t>(size, chunk_size));
+  }
+}
+
+dbSectionReadBuf::~dbSectionReadBuf()
+{
+  if (codec_ == dbSectionCodec::ZLIB) {
+    inflateEnd(&zstream_);
+  }
+}
+
+void dbSectionReadBuf::corrupt(int status) const
+{
+  throw ZException("Corrupt database section: zlib error %d", status);
+}
+
+const char* dbSectionReadBuf::nextStored(size_t& size)
+{
+  size = std::min<uint64_t>(remaining_, chunk_size);
+  remaining_ -= size;
+  if (data_ != nullptr) {
+    const char* stored = data_;
+    data_ += size;
+    return stored;
+  }
+  source_->readBytes(input_.data(), size);
+  return input_.data();
+}
+
+dbSectionReadBuf::int_type dbSectionReadBuf::underflow()
+{
+  if (codec_ == dbSectionCodec::NONE) {
+    if (remaining_ == 0) {
+      return traits_type::eof();
+    }
+    size_t size;
+    char* stored = const_cast<char*>(nextStored(size));
+    setg(stored, stored, stored + size);
+    raw_read_ += size;
+    return traits_type::to_int_type(*gptr());
+  }
+
+  while (!stream_end_) {
+    if (zstream_.avail_in == 0 && remaining_ > 0) {
+      size_t size;
+      zstream_.next_in
+          = reinterpret_cast<Bytef*>(const_cast<char*>(nextStored(size)));
+      zstream_.avail_in = size;
+    }
+    zstream_.next_out = reinterpret_cast<Bytef*>(output_.data());
+    zstream_.avail_out = output_.size();
+    const int status = inflate(&zstream_, Z_NO_FLUSH);
+    if (status == Z_STREAM_END) {
+      stream_end_ = true;
+    } else if (status != Z_OK) {
+      corrupt(status);
+    }
+    const size_t size = output_.size() - zstream_.avail_out;
+    if (size > 0) {
+      setg(output_.data(), output_.data(), output_.data() + size);
+      raw_read_ += size;
+      return traits_type::to_int_type(*gptr());
+    }
+  }
+  return traits_type::eof();
+}
+
+void dbSectionReadBuf::finish()
+{
+  setg(nullptr, nullptr, nullptr);
+  if (codec_ == dbSectionCodec::ZLIB) {
+    while (!traits_type::eq_int_type(underflow(), traits_type::eof())) {
+      setg(nullptr, nullptr, nullptr);
+    }
+    if (raw_read_ != raw_size_) {
+      corrupt(Z_DATA_ERROR);
+    }
+  }
+  if (source_ != nullptr) {
+    source_->skip(remaining_);
+  }
+}
+
+// Run read on the raw bytes of a section stored with codec.
+static void readStoredSection(dbSectionCodec codec,
+                              const char* data,
+                              dbIStream* source,
+                              uint64_t size,
+                              uint64_t raw_size,
+                              const std::function<void(std::istream&)>& read)
+{
+  constexpr auto exceptions
+      = std::ios::failbit | std::ios::badbit | std::ios::eofbit;
+  if (codec == dbSectionCodec::NONE && data != nullptr) {
+    dbMemoryStreamBuf buffer(data, size);
+    std::istream section_file(&buffer);
+    section_file.exceptions(exceptions);
+    read(section_file);
+    return;
+  }
+
+  dbSectionReadBuf buffer(codec, data, source, size, raw_size);
+  std::istream section_file(&buffer);
+  section_file.exceptions(exceptions);
+  read(section_file);
+  buffer.finish();
+}
+
+void readSection(dbSectionCodec codec,
+                 const char* data,
+                 uint64_t size,
+                 uint64_t raw_size,
+                 const std::function<void(std::istream&)>& read)
+{
+  readStoredSection(codec, data, nullptr, size, raw_size, read);
+}
+
+// Write one frame, patching its sizes in once the section is written.
+static void writeFrame(dbOStream& stream,
+                       dbSectionCodec codec,
+                       const std::function<void(dbSectionWriteBuf&)>& write)
+{
+  const auto header = stream.pos();
+  stream << (uint8_t) codec;
+  stream << (uint64_t) 0;
+  stream << (uint64_t) 0;
+
+  dbSectionWriteBuf buffer(codec != dbSectionCodec::NONE,
+                           [&stream](const char* data, size_t size) {
+                             stream.writeBytes(data, size);
+                           });
+  write(buffer);
+  uint64_t raw_size;
+  uint64_t stored_size;
+  buffer.finish(raw_size, stored_size);
+
+  const auto end = stream.pos();
+  stream.seek(header);
+  stream << (uint8_t) codec;
+  stream << raw_size;
+  stream << stored_size;
+  stream.seek(end);
+}
+
+// Serialize section into buffer through a child stream of parent.
+static void writeSection(const dbOStream& parent,
+                         const dbSection& section,
+                         dbSectionWriteBuf& buffer)
+{
+  std::ostream section_file(&buffer);
+  section_file.exceptions(std::ios::badbit);
+  dbOStream section_stream(parent, section_file);
+  {
+    dbOStreamScope scope(section_stream, section.name);
+    section.write(section_stream);
+  }
+  section_file.flush();
+}
+
+void writeSections(dbOStream& stream, const std::vector<dbSection>& sections)
+{
+  const int count = sections.size();
+  stream << (uint32_t) count;
+
+  const dbSectionCodec codec = stream.getCompress() ? dbSectionCodec::ZLIB
+                                                    : dbSectionCodec::NONE;
+  const int threads = stream.getThreads();
+  if (codec == dbSectionCodec::NONE || threads <= 1) {
+    // Nothing to gain from threads; stream every section into the file.
+    for (const dbSection& section : sections) {
+      writeFrame(stream, codec, [&](dbSectionWriteBuf& buffer) {
+        writeSection(stream, section, buffer);
+      });
+    }
+    return;
+  }
+
+  // Compress a window of sections ahead on the threads of the stream and
+  // write it out in order before compressing the next one, so that at most
+  // a window of compressed sections is held at once.
+  std::vector<std::string> stored(threads);
+  std::vector<uint64_t> raw_sizes(threads);
+  for (int begin = 0; begin < count; begin += threads) {
+    const int end = std::min(begin + threads, count);
+    utl::ThreadException exception;
+#pragma omp parallel for num_threads(threads) schedule(dynamic, 1)
+    for (int i = begin; i < end; i++) {
+      try {
+        std::string& section_stored = stored[i - begin];
+        dbSectionWriteBuf buffer(
+            true, [&section_stored](const char* data, size_t size) {
+              section_stored.append(data, size);
+            });
+        writeSection(stream, sections[i], buffer);
+        uint64_t stored_size;
+        buffer.finish(raw_sizes[i - begin], stored_size);
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    for (int i = 0; i < end - begin; i++) {
+      stream << (uint8_t) codec;
+      stream << raw_sizes[i];
+      stream << (uint64_t) stored[i].size();
+      stream.writeBytes(stored[i].data(), stored[i].size());
+      std::string().swap(stored[i]);
+    }
+  }
+}
+
+void readSections(dbIStream& stream,
+                  const std::vector<dbSection>& sections,
+                  std::vector<std::unique_ptr<dbLazySection>>& lazy_sections)
+{
+  struct Frame
+  {
+    int section = 0;
+    dbSectionCodec codec = dbSectionCodec::NONE;
+    uint64_t raw_size = 0;
+    uint64_t size = 0;
+    const char* data = nullptr;
+    std::string buffer;
+  };
+
+  uint32_t count;
+  stream >> count;
+  if (count != sections.size()) {
+    throw ZException("Database block has %u sections, expected %zu",
+                     count,
+                     sections.size());
+  }
+
+  // Sections of a mapped file are read in place on the threads of the
+  // stream.  Otherwise only compressed sections read on several threads are
+  // buffered, as they are stored; the others are read straight from the
+  // stream.
+  _dbDatabase* db = stream.getDatabase();
+  const std::shared_ptr<dbMappedFile>& file = stream.getMappedFile();
+  const int threads = stream.getThreads();
+  std::vector<Frame> frames;
+  for (uint32_t i = 0; i < count; i++) {
+    uint8_t codec;
+    uint64_t raw_size;
+    uint64_t size;
+    stream >> codec;
+    stream >> raw_size;
+    stream >> size;
+    if (codec > (uint8_t) dbSectionCodec::ZLIB) {
+      throw ZException("Unknown database section codec %d", (int) codec);
+    }
+
+    const char* data = nullptr;
+    if (file != nullptr) {
+      const uint64_t offset = stream.pos();
+      stream.skip(size);
+      if (!sections[i].lazy_tables.empty()) {
+        lazy_sections.push_back(
+            std::make_unique<dbLazySection>(db,
+                                            stream.getSchemaMinor(),
+                                            file,
+                                            offset,
+                                            size,
+                                            (dbSectionCodec) codec,
+                                            raw_size,
+                                            sections[i].lazy_tables,
+                                            sections[i].read));
+        continue;
+      }
+      data = file->data() + offset;
+    } else if (codec == (uint8_t) dbSectionCodec::NONE || threads <= 1) {
+      readStoredSection((dbSectionCodec) codec,
+                        nullptr,
+                        &stream,
+                        size,
+                        raw_size,
+                        [&](std::istream& section_file) {
+                          dbIStream section_stream(stream, section_file);
+                          sections[i].read(section_stream);
+                        });
+      continue;
+    }
+
+    Frame& frame = frames.emplace_back();
+    frame.section = i;
+    frame.codec = (dbSectionCodec) codec;
+    frame.raw_size = raw_size;
+    frame.size = size;
+    frame.data = data;
+    if (data == nullptr) {
+      frame.buffer.resize(size);
+      stream.readBytes(frame.buffer.data(), size);
+      frame.data = frame.buffer.data();
+    }
+  }
+
+  utl::ThreadException exception;
+#pragma omp parallel for num_threads(threads) schedule(dynamic, 1)
+  for (int i = 0; i < (int) frames.size(); i++) {
+    try {
+      Frame& frame = frames[i];
+      readSection(frame.codec,
+                  frame.data,
+                  frame.size,
+                  frame.raw_size,
+                  [&](std::istream& section_file) {
+                    dbIStream section_stream(stream, section_file);
+                    sections[frame.section].read(section_stream);
+                  });
+      std::string().swap(frame.buffer);
+    } catch (...) {
+      exception.capture();
+    }
+  }
+  exception.rethrow();
+}
+
+}  // namespace odb
@@ -0,0 +1,93 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace odb {
+
+class dbIStream;
+class dbLazySection;
+class dbObjectTable;
+class dbOStream;
+
+// How the bytes of a section are stored in the file.
+enum class dbSectionCodec : uint8_t
+{
+  NONE = 0,
+  ZLIB = 1
+};
+
+//
+// A group of tables of a block that is serialized into its own frame so
+// that it can be written, compressed and read independently of the others.
+//
+struct dbSection
+{
+  const char* name;
+  // Tables that are only read on their first access when the file is
+  // mapped.  Empty if the section is always read with the block.
+  std::vector<dbObjectTable*> lazy_tables;
+  std::function<void(dbOStream&)> write;
+  std::function<void(dbIStream&)> read;
+};
+
+// Write the sections as frames of codec (uint8), raw size (uint64), stored
+// size (uint64) and the stored bytes, preceded by the number of frames.
+// Sections are streamed into the file; only compressed sections are
+// buffered, a window at a time, when they are compressed on the threads of
+// the stream.
+void writeSections(dbOStream& stream, const std::vector<dbSection>& sections);
+
+// Read the frames written by writeSections.  Sections of a mapped file and
+// compressed sections are deserialized on the threads of the stream.  Lazy
+// sections of a mapped file are skipped and appended to lazy_sections
+// instead.
+void readSections(dbIStream& stream,
+                  const std::vector<dbSection>& sections,
+                  std::vector<std::unique_ptr<dbLazySection>>& lazy_sections);
+
+// Run read on the raw bytes of the section stored with codec at data.
+// Compressed sections are inflated a chunk at a time.
+void readSection(dbSectionCodec codec,
+                 const char* data,
+                 uint64_t size,
+                 uint64_t raw_size,
+                 const std::function<void(std::istream&)>& read);
+
+}  // namespace odb
@@ -362,8 +362,7 @@ dbIStream& operator>>(dbIStream& stream, _dbSite& site)
   stream >> site._height;
   stream >> site._width;
   stream >> site._next_entry;
-  _dbDatabase* db = site.getImpl()->getDatabase();
-  if (db->isSchema(db_schema_site_row_pattern)) {
+  if (stream.isSchema(db_schema_site_row_pattern)) {
     stream >> site._row_pattern;
   }
   return stream;
@@ -116,6 +116,8 @@ dbIStream& operator>>(dbIStream& stream, Oct& o)
 dbOStream::dbOStream(_dbDatabase* db, std::ostream& f) : _f(f)
 {
   _db = db;
+  _threads = 1;
+  _compress = false;
   _lef_dist_factor = 0.001;
   _lef_area_factor = 0.000001;
 
@@ -127,9 +129,20 @@ dbOStream::dbOStream(_dbDatabase* db, std::ostream& f) : _f(f)
   }
 }
 
+dbOStream::dbOStream(const dbOStream& parent, std::ostream& f) : _f(f)
+{
+  _db = parent._db;
+  _threads = parent._threads;
+  _compress = parent._compress;
+  _lef_dist_factor = parent._lef_dist_factor;
+  _lef_area_factor = parent._lef_area_factor;
+}
+
 dbIStream::dbIStream(_dbDatabase* db, std::istream& f) : _f(f)
 {
   _db = db;
+  _threads = 1;
+  _schema_minor = db->_schema_minor;
 
   _lef_dist_factor = 0.001;
   _lef_area_factor = 0.000001;
@@ -142,6 +155,15 @@ dbIStream::dbIStream(_dbDatabase* db, std::istream& f) : _f(f)
   }
 }
 
+dbIStream::dbIStream(const dbIStream& parent, std::istream& f) : _f(f)
+{
+  _db = parent._db;
+  _threads = parent._threads;
+  _schema_minor = parent._schema_minor;
+  _lef_dist_factor = parent._lef_dist_factor;
+  _lef_area_factor = parent._lef_area_factor;
+}
+
 std::ostream& operator<<(std::ostream& os, const Rect& box)
 {
   os << "( " << box.xMin() << " " << box.yMin() << " ) ( " << box.xMax() << " "
@@ -89,7 +89,11 @@ class dbTable : public dbObjectTable, public dbIterator
   ~dbTable() override;
 
   // returns the number of instances of "T" allocated
-  uint size() const { return _alloc_cnt; }
+  uint size() const
+  {
+    ensureLoaded();
+    return _alloc_cnt;
+  }
 
   // Create a "T", calls T( _dbDatabase * )
   T* create();
@@ -108,6 +112,7 @@ class dbTable : public dbObjectTable, public dbIterator
   // Get the object of this id
   T* getPtr(dbId<T> id) const
   {
+    ensureLoaded();
     uint page = (uint) id >> _page_shift;
     uint offset = (uint) id & _page_mask;
 
@@ -119,6 +124,7 @@ class dbTable : public dbObjectTable, public dbIterator
 
   bool validId(dbId<T> id) const
   {
+    ensureLoaded();
     uint page = (uint) id >> _page_shift;
     uint offset = (uint) id & _page_mask;
 
@@ -150,16 +150,18 @@ dbTable<T>::dbTable(_dbDatabase* db,
 template <class T>
 dbTable<T>::dbTable(_dbDatabase* db, dbObject* owner, const dbTable<T>& t)
     : dbObjectTable(db, owner, t._getObjectTable, t._type, sizeof(T)),
-      _page_mask(t._page_mask),
-      _page_shift(t._page_shift),
-      _top_idx(t._top_idx),
-      _bottom_idx(t._bottom_idx),
-      _page_cnt(t._page_cnt),
-      _page_tbl_size(t._page_tbl_size),
-      _alloc_cnt(t._alloc_cnt),
-      _free_list(t._free_list),
       _pages(nullptr)
 {
+  // Read any pending section of t before copying its state.
+  t.ensureLoaded();
+  _page_mask = t._page_mask;
+  _page_shift = t._page_shift;
+  _top_idx = t._top_idx;
+  _bottom_idx = t._bottom_idx;
+  _page_cnt = t._page_cnt;
+  _page_tbl_size = t._page_tbl_size;
+  _alloc_cnt = t._alloc_cnt;
+  _free_list = t._free_list;
   copy_pages(t);
 }
 
@@ -242,6 +244,7 @@ void dbTable<T>::newPage()
 template <class T>
 T* dbTable<T>::create()
 {
+  ensureLoaded();
   ++_alloc_cnt;
 
   if (_free_list == 0) {
@@ -272,6 +275,7 @@ T* dbTable<T>::create()
 template <class T>
 T* dbTable<T>::duplicate(T* c)
 {
+  ensureLoaded();
   ++_alloc_cnt;
 
   if (_free_list == 0) {
@@ -460,6 +464,7 @@ void dbTable<T>::reverse(dbObject* /* unused: parent */)
 template <class T>
 uint dbTable<T>::sequential()
 {
+  ensureLoaded();
   return _top_idx;
 }
 
@@ -472,6 +477,7 @@ uint dbTable<T>::size(dbObject* /* unused: parent */)
 template <class T>
 uint dbTable<T>::begin(dbObject* /* unused: parent */)
 {
+  ensureLoaded();
   return _bottom_idx;
 }
 
@@ -634,6 +640,7 @@ dbOStream& operator<<(dbOStream& stream, const NamedTable<T>& named_table)
 template <class T>
 dbOStream& operator<<(dbOStream& stream, const dbTable<T>& table)
 {
+  table.ensureLoaded();
   stream << table._page_mask;
   stream << table._page_shift;
   stream << table._top_idx;
@@ -703,6 +710,8 @@ bool dbTable<T>::operator!=(const dbTable<T>& table) const
 template <class T>
 bool dbTable<T>::operator==(const dbTable<T>& rhs) const
 {
+  ensureLoaded();
+  rhs.ensureLoaded();
   const dbTable<T>& lhs = *this;
 
   // These basic parameters should be the same...
@@ -758,6 +767,8 @@ bool dbTable<T>::operator==(const dbTable<T>& rhs) const
 template <class T>
 void dbTable<T>::differences(dbDiff& diff, const dbTable<T>& rhs) const
 {
+  ensureLoaded();
+  rhs.ensureLoaded();
   const dbTable<T>& lhs = *this;
 
   // These basic parameters should be the same...
@@ -818,6 +829,7 @@ void dbTable<T>::differences(dbDiff& diff, const dbTable<T>& rhs) const
 template <class T>
 void dbTable<T>::out(dbDiff& diff, char side) const
 {
+  ensureLoaded();
   uint i;
 
   for (i = _bottom_idx; i <= _top_idx; ++i) {
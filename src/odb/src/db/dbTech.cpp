@@ -524,8 +524,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbTech& tech)
 
 dbIStream& operator>>(dbIStream& stream, _dbTech& tech)
 {
-  _dbDatabase* db = tech.getImpl()->getDatabase();
-  if (db->isSchema(db_schema_block_tech)) {
+  if (stream.isSchema(db_schema_block_tech)) {
     stream >> tech._name;
   } else {
     tech._name = "";
@@ -858,21 +858,21 @@ dbIStream& operator>>(dbIStream& stream, _dbTechLayer& obj)
   stream >> *obj.width_table_rules_tbl_;
   stream >> *obj.min_cuts_rules_tbl_;
   stream >> *obj.area_rules_tbl_;
-  if (obj.getDatabase()->isSchema(db_schema_lef58_forbidden_spacing)) {
+  if (stream.isSchema(db_schema_lef58_forbidden_spacing)) {
     stream >> *obj.forbidden_spacing_rules_tbl_;
   }
-  if (obj.getDatabase()->isSchema(db_schema_keepout_zone)) {
+  if (stream.isSchema(db_schema_keepout_zone)) {
     stream >> *obj.keepout_zone_rules_tbl_;
   }
-  if (obj.getDatabase()->isSchema(db_schema_wrongdir_spacing)) {
+  if (stream.isSchema(db_schema_wrongdir_spacing)) {
     stream >> *obj.wrongdir_spacing_rules_tbl_;
   }
-  if (obj.getDatabase()->isSchema(
+  if (stream.isSchema(
           db_schema_lef58_two_wires_forbidden_spacing)) {
     stream >> *obj.two_wires_forbidden_spc_rules_tbl_;
   }
   // User Code Begin >>
-  if (obj.getDatabase()->isSchema(db_schema_layer_adjustment)) {
+  if (stream.isSchema(db_schema_layer_adjustment)) {
     stream >> obj.layer_adjustment_;
   } else {
     obj.layer_adjustment_ = 0.0;
@@ -915,7 +915,7 @@ dbIStream& operator>>(dbIStream& stream, _dbTechLayer& obj)
   stream >> obj._two_widths_sp_spacing;
   stream >> obj._oxide1;
   stream >> obj._oxide2;
-  if (obj.getDatabase()->isSchema(db_schema_wrongway_width)) {
+  if (stream.isSchema(db_schema_wrongway_width)) {
     stream >> obj.wrong_way_width_;
   } else {
     obj.wrong_way_width_ = obj._width;
@@ -926,7 +926,7 @@ dbIStream& operator>>(dbIStream& stream, _dbTechLayer& obj)
       }
     }
   }
-  if (obj.getDatabase()->isSchema(db_schema_lef58_pitch)) {
+  if (stream.isSchema(db_schema_lef58_pitch)) {
     stream >> obj._first_last_pitch;
   }
   // User Code End >>
@@ -1718,6 +1718,10 @@ void dbWire::append(dbWire* src_, bool singleSegmentWire)
       dst->_data[i] += sz;
     }
   }
+  _dbNet* net = (_dbNet*) getNet();
+  if (net && !dst->_flags._is_global) {
+    net->markWireAltered();
+  }
   for (auto callback : ((_dbBlock*) getBlock())->_callbacks) {
     callback->inDbWirePostAppend(src_, this);
   }
@@ -1748,6 +1752,7 @@ void dbWire::attach(dbNet* net_)
 
   wire->_net = net->getOID();
   net->_wire = wire->getOID();
+  net->markWireAltered();
   for (auto callback : block->_callbacks) {
     callback->inDbWirePostAttach(this);
   }
@@ -1767,6 +1772,7 @@ void dbWire::detach()
 
   _dbNet* net = (_dbNet*) getNet();
   net->_wire = 0;
+  net->markWireAltered();
   wire->_net = 0;
   for (auto callback : block->_callbacks) {
     callback->inDbWirePostDetach(this, (dbNet*) net);
@@ -1867,6 +1873,11 @@ void dbWire::setRawWireData(const std::vector<int>& data,
   wire->_data = data;
   wire->_opcodes = op_codes;
   net->_flags._wire_ordered = 0;
+  net->markWireAltered();
+
+  for (auto callback : ((_dbBlock*) getBlock())->_callbacks) {
+    callback->inDbWirePostModify(this);
+  }
 }
 
 }  // namespace odb
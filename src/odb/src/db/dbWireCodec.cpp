@@ -622,6 +622,12 @@ void dbWireEncoder::end()
   ((_dbBlock*) _block)->_flags._valid_bbox = 0;
   _point_cnt = 0;
 
+  // Parasitics of the net no longer match its wire.
+  _dbNet* net = (_dbNet*) ((dbWire*) _wire)->getNet();
+  if (net && !_wire->_flags._is_global) {
+    net->markWireAltered();
+  }
+
   for (auto callback : ((_dbBlock*) _block)->_callbacks) {
     callback->inDbWirePostModify((dbWire*) _wire);
   }
@@ -182,6 +182,8 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path)
 
 int write_db(odb::dbDatabase* db, const char* db_path)
 {
+  // db_path may be the file a lazy read mapped; read it before truncating.
+  db->loadSections();
   std::ofstream fp(db_path, std::ios::binary);
   if (!fp) {
     int errnum = errno;
@@ -78,10 +78,39 @@ Ath__parser::Ath__parser(utl::Logger* logger)
   init();
 }
 
+std::string shellQuote(const char* name)
+{
+  std::string quoted = "'";
+  for (const char* c = name; *c != '\0'; c++) {
+    if (*c == '\'') {
+      quoted += "'\\''";
+    } else {
+      quoted += *c;
+    }
+  }
+  quoted += "'";
+  return quoted;
+}
+
+// Gets the command that decompresses a .gz or .zst file to its output.
+static bool getDecompressCmd(const char* name, std::string& cmd)
+{
+  const size_t len = strlen(name);
+  if (len > 4 && !strcmp(name + len - 3, ".gz")) {
+    cmd = "gzip -cd " + shellQuote(name);
+    return true;
+  }
+  if (len > 5 && !strcmp(name + len - 4, ".zst")) {
+    cmd = "zstd -dcq " + shellQuote(name);
+    return true;
+  }
+  return false;
+}
+
 Ath__parser::~Ath__parser()
 {
-  if (_inFP && strlen(_inputFile) > 4
-      && !strcmp(_inputFile + strlen(_inputFile) - 3, ".gz")) {
+  std::string cmd;
+  if (_inFP && getDecompressCmd(_inputFile, cmd)) {
     char buff[1024];
     while (!feof(_inFP)) {
       if (fread(buff, 1, 1023, _inFP) != 1) {
@@ -162,15 +191,11 @@ void Ath__parser::addSeparator(const char* s)
 
 void Ath__parser::openFile(const char* name)
 {
-  if (name != nullptr && strlen(name) > 4
-      && !strcmp(name + strlen(name) - 3, ".gz")) {
-    char cmd[256];
-    sprintf(cmd, "gzip -cd %s", name);
-    _inFP = popen(cmd, "r");
+  std::string cmd;
+  if (name != nullptr && getDecompressCmd(name, cmd)) {
+    _inFP = popen(cmd.c_str(), "r");
     strcpy(_inputFile, name);
-  } else if (name == nullptr && strlen(_inputFile) > 4
-             && !strcmp(_inputFile + strlen(_inputFile) - 3, ".gz")) {
-    char cmd[256];
+  } else if (name == nullptr && getDecompressCmd(_inputFile, cmd)) {
     if (_inFP) {
       char buff[1024];
       while (!feof(_inFP)) {
@@ -181,8 +206,7 @@ void Ath__parser::openFile(const char* name)
       pclose(_inFP);
       _inFP = nullptr;
     }
-    sprintf(cmd, "gzip -cd %s", _inputFile);
-    _inFP = popen(cmd, "r");
+    _inFP = popen(cmd.c_str(), "r");
   } else if (name != nullptr) {
     _inFP = ATH__openFile(name, "r", _logger);
     strcpy(_inputFile, name);
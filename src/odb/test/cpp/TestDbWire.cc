@@ -130,4 +130,50 @@ TEST_F(OdbMultiPatternedTest, WireColorIsClearedOnNewPath)
   EXPECT_EQ(decoder.getColor().value(), /*mask_color=*/2);
 }
 
+TEST_F(OdbMultiPatternedTest, WireChangesMarkExtractedNetWireAltered)
+{
+  // Arrange
+  dbNet* net0 = dbNet::create(block_.get(), "net0");
+  dbNet* net1 = dbNet::create(block_.get(), "net1");
+  dbTechLayer* met1 = lib_->getTech()->findLayer("met1");
+  dbWire* wire = dbWire::create(net0);
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(100, 50);
+  encoder.end();
+
+  // Act & Assert
+  // A net that was never extracted keeps its flag clear.
+  EXPECT_FALSE(net0->isWireAltered());
+
+  dbRSeg::create(net0, 0, 0, 0, true);
+  dbRSeg::create(net1, 0, 0, 0, true);
+  encoder.begin(wire);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 50);
+  encoder.addPoint(150, 50);
+  encoder.end();
+  EXPECT_TRUE(net0->isWireAltered());
+
+  net0->setWireAltered(false);
+  wire->detach();
+  EXPECT_TRUE(net0->isWireAltered());
+
+  wire->attach(net1);
+  EXPECT_TRUE(net1->isWireAltered());
+
+  net1->setWireAltered(false);
+  dbWire* other = dbWire::create(block_.get());
+  encoder.begin(other);
+  encoder.newPath(met1, dbWireType::ROUTED);
+  encoder.addPoint(50, 100);
+  encoder.addPoint(100, 100);
+  encoder.end();
+  EXPECT_FALSE(net1->isWireAltered());
+  wire->append(other);
+  EXPECT_TRUE(net1->isWireAltered());
+}
+
 }  // namespace odb
@@ -0,0 +1,140 @@
+#define BOOST_TEST_MODULE TestLazyRead
+#include <unistd.h>
+
+#include <boost/test/included/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "helper.h"
+#include "odb/db.h"
+#include "utl/Logger.h"
+
+namespace odb {
+namespace {
+
+std::string writeToTempFile(dbDatabase* db)
+{
+  char path[] = "/tmp/TestLazyReadXXXXXX";
+  close(mkstemp(path));
+  std::ofstream file(path, std::ios::binary);
+  db->write(file);
+  return path;
+}
+
+std::string writeToString(dbDatabase* db)
+{
+  std::ostringstream stream;
+  db->write(stream);
+  return stream.str();
+}
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_sections_on_access)
+{
+  dbDatabase* db = createRoutedDB();
+  const std::string path = writeToTempFile(db);
+
+  dbDatabase* mapped = dbDatabase::create();
+  mapped->setLogger(new utl::Logger());
+  mapped->readMapped(path.c_str());
+
+  dbBlock* block = mapped->getChip()->getBlock();
+  dbNet* net = block->findNet("n1");
+  BOOST_TEST(net->getGuides().size() == 1);
+  BOOST_TEST(net->getWire() != nullptr);
+  BOOST_TEST(net->getWire()->getLength() == 100);
+  dbIntProperty* weight = dbIntProperty::find(net, "weight");
+  BOOST_TEST(weight != nullptr);
+  BOOST_TEST(weight->getValue() == 3);
+  BOOST_TEST(net->getCapNodes().size() == 1);
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_concurrent_access)
+{
+  dbDatabase* db = createRoutedDB();
+  const std::string path = writeToTempFile(db);
+
+  dbDatabase* mapped = dbDatabase::create();
+  mapped->setLogger(new utl::Logger());
+  mapped->readMapped(path.c_str());
+
+  // The first access of every thread races to read the wire section.
+  dbNet* net = mapped->getChip()->getBlock()->findNet("n1");
+  std::vector<int> lengths(8);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < (int) lengths.size(); i++) {
+    threads.emplace_back(
+        [net, &lengths, i]() { lengths[i] = net->getWire()->getLength(); });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (int length : lengths) {
+    BOOST_TEST(length == 100);
+  }
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_round_trip)
+{
+  dbDatabase* db = createRoutedDB();
+  const std::string path = writeToTempFile(db);
+
+  dbDatabase* mapped = dbDatabase::create();
+  mapped->setLogger(new utl::Logger());
+  mapped->readMapped(path.c_str());
+
+  // Writing reads the pending sections and must reproduce the file.
+  BOOST_TEST(writeToString(mapped) == writeToString(db));
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_overwrite_mapped_file)
+{
+  dbDatabase* db = createRoutedDB();
+  const std::string path = writeToTempFile(db);
+
+  dbDatabase* mapped = dbDatabase::create();
+  mapped->setLogger(new utl::Logger());
+  mapped->readMapped(path.c_str());
+
+  mapped->loadSections();
+  {
+    std::ofstream file(path, std::ios::binary);
+    mapped->write(file);
+  }
+
+  dbDatabase* reread = dbDatabase::create();
+  reread->setLogger(new utl::Logger());
+  reread->readMapped(path.c_str());
+  BOOST_TEST(writeToString(reread) == writeToString(db));
+
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(test_stream_read)
+{
+  // Sections are read in place when the file is not mapped.
+  dbDatabase* db = createRoutedDB();
+  std::istringstream stream(writeToString(db));
+
+  dbDatabase* streamed = dbDatabase::create();
+  streamed->setLogger(new utl::Logger());
+  streamed->read(stream);
+
+  BOOST_TEST(writeToString(streamed) == writeToString(db));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
@@ -0,0 +1,134 @@
+#define BOOST_TEST_MODULE TestNameIndex
+#include <boost/test/included/unit_test.hpp>
+#include <string>
+#include <vector>
+
+#include "helper.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+template <class T>
+static std::vector<std::string> names(const std::vector<T*>& objs)
+{
+  std::vector<std::string> result;
+  for (T* obj : objs) {
+    result.push_back(obj->getName());
+  }
+  return result;
+}
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_nets)
+{
+  dbDatabase* db = createSimpleDB();
+  dbBlock* block = db->getChip()->getBlock();
+  dbNet::create(block, "b/n2");
+  dbNet::create(block, "a/n1");
+  dbNet::create(block, "b/n1");
+  dbNet* net = dbNet::create(block, "bb");
+
+  std::vector<dbNet*> nets;
+  block->findNetsByPrefix("b/", nets);
+  BOOST_TEST((names(nets) == std::vector<std::string>{"b/n1", "b/n2"}));
+
+  nets.clear();
+  block->findNetsByPrefix("", nets);
+  BOOST_TEST(nets.size() == 4);
+
+  // The index follows edits.
+  net->rename("b/n0");
+  dbNet::destroy(block->findNet("b/n2"));
+  dbNet::create(block, "b/n3");
+  nets.clear();
+  block->findNetsByPrefix("b/", nets);
+  BOOST_TEST(
+      (names(nets) == std::vector<std::string>{"b/n0", "b/n1", "b/n3"}));
+
+  nets.clear();
+  block->findNetsByPrefix("c", nets);
+  BOOST_TEST(nets.empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_insts)
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  dbBlock* block = db->getChip()->getBlock();
+
+  std::vector<dbInst*> insts;
+  block->findInstsByPrefix("i", insts);
+  BOOST_TEST((names(insts) == std::vector<std::string>{"i1", "i2", "i3"}));
+
+  dbInst::destroy(block->findInst("i2"));
+  block->findInst("i3")->rename("j3");
+  insts.clear();
+  block->findInstsByPrefix("i", insts);
+  BOOST_TEST((names(insts) == std::vector<std::string>{"i1"}));
+}
+
+BOOST_AUTO_TEST_CASE(test_reserve)
+{
+  // Reserve on an empty net table, then fill it.
+  dbDatabase* db = createSimpleDB();
+  dbBlock* block = db->getChip()->getBlock();
+  block->reserveNames(0, 1000);
+  for (int i = 0; i < 1000; i++) {
+    dbNet::create(block, ("n" + std::to_string(i)).c_str());
+  }
+  BOOST_TEST(block->getNets().size() == 1000);
+  for (int i = 0; i < 1000; i++) {
+    const std::string name = "n" + std::to_string(i);
+    dbNet* net = block->findNet(name.c_str());
+    BOOST_TEST_REQUIRE(net != nullptr);
+    BOOST_TEST(net->getName() == name);
+  }
+
+  // Reserve on tables that already hold names.
+  db = create2LevetDbNoBTerms();
+  block = db->getChip()->getBlock();
+  dbMaster* and2 = db->findMaster("and2");
+  block->reserveNames(1000, 1000);
+  for (const char* name : {"i1", "i2", "i3"}) {
+    BOOST_TEST(block->findInst(name) != nullptr);
+  }
+  for (const char* name : {"n1", "n2", "n3", "n4", "n5", "n6", "n7"}) {
+    BOOST_TEST(block->findNet(name) != nullptr);
+  }
+  for (int i = 0; i < 1000; i++) {
+    const std::string name = "u" + std::to_string(i);
+    dbInst::create(block, and2, name.c_str());
+    dbNet::create(block, name.c_str());
+  }
+  // A smaller reserve keeps the larger table.
+  block->reserveNames(10, 10);
+  for (int i = 0; i < 1000; i++) {
+    const std::string name = "u" + std::to_string(i);
+    BOOST_TEST(block->findInst(name.c_str()) != nullptr);
+    BOOST_TEST(block->findNet(name.c_str()) != nullptr);
+  }
+  BOOST_TEST(block->findInst("i2") != nullptr);
+  BOOST_TEST(block->findNet("n7") != nullptr);
+
+  // Destroying names while the reserved table is still sparse.
+  db = createSimpleDB();
+  block = db->getChip()->getBlock();
+  block->reserveNames(0, 1000);
+  for (int i = 0; i < 1000; i++) {
+    dbNet* net = dbNet::create(block, ("n" + std::to_string(i)).c_str());
+    if (i % 2 == 1) {
+      dbNet::destroy(net);
+    }
+  }
+  BOOST_TEST(block->getNets().size() == 500);
+  for (int i = 0; i < 1000; i++) {
+    const std::string name = "n" + std::to_string(i);
+    BOOST_TEST((block->findNet(name.c_str()) != nullptr) == (i % 2 == 0));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
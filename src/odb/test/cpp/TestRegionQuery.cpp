@@ -0,0 +1,203 @@
+#define BOOST_TEST_MODULE TestRegionQuery
+#include <boost/test/included/unit_test.hpp>
+
+#include <thread>
+#include <vector>
+
+#include "helper.h"
+#include "odb/db.h"
+#include "odb/dbWireCodec.h"
+
+namespace odb {
+namespace {
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_insts)
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  dbBlock* block = db->getChip()->getBlock();
+  dbInst* i1 = block->findInst("i1");
+  dbInst* i2 = block->findInst("i2");
+  i1->setLocation(0, 0);
+  i1->setPlacementStatus(dbPlacementStatus::PLACED);
+  i2->setLocation(5000, 5000);
+  i2->setPlacementStatus(dbPlacementStatus::PLACED);
+
+  // i3 is unplaced and must not be reported.
+  auto shapes = block->queryRegion(
+      nullptr, Rect(0, 0, 500, 500), dbRegionQueryShape::INST);
+  BOOST_TEST(shapes.size() == 1);
+  BOOST_TEST(shapes[0].object == i1);
+  BOOST_TEST(shapes[0].box == Rect(0, 0, 1000, 1000));
+
+  // Moves are tracked after the index is built.
+  i1->setLocation(10000, 10000);
+  shapes = block->queryRegion(
+      nullptr, Rect(0, 0, 500, 500), dbRegionQueryShape::INST);
+  BOOST_TEST(shapes.empty());
+  shapes = block->queryRegion(
+      nullptr, Rect(4000, 4000, 12000, 12000), dbRegionQueryShape::INST);
+  BOOST_TEST(shapes.size() == 2);
+
+  dbInst::destroy(i2);
+  shapes = block->queryRegion(
+      nullptr, Rect(4000, 4000, 12000, 12000), dbRegionQueryShape::INST);
+  BOOST_TEST(shapes.size() == 1);
+  BOOST_TEST(shapes[0].object == i1);
+}
+
+BOOST_AUTO_TEST_CASE(test_release)
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  dbBlock* block = db->getChip()->getBlock();
+  dbInst* i1 = block->findInst("i1");
+  i1->setLocation(0, 0);
+  i1->setPlacementStatus(dbPlacementStatus::PLACED);
+  auto shapes = block->queryRegion(
+      nullptr, Rect(0, 0, 500, 500), dbRegionQueryShape::INST);
+  BOOST_TEST(shapes.size() == 1);
+
+  // Moves made while the index is released are seen by the rebuild.
+  block->releaseRegionQuery();
+  i1->setLocation(10000, 10000);
+  shapes = block->queryRegion(
+      nullptr, Rect(0, 0, 500, 500), dbRegionQueryShape::INST);
+  BOOST_TEST(shapes.empty());
+  shapes = block->queryRegion(
+      nullptr, Rect(10000, 10000, 10500, 10500), dbRegionQueryShape::INST);
+  BOOST_TEST(shapes.size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_concurrent_build)
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  dbBlock* block = db->getChip()->getBlock();
+  dbInst* i1 = block->findInst("i1");
+  i1->setLocation(0, 0);
+  i1->setPlacementStatus(dbPlacementStatus::PLACED);
+
+  // The first queries race to build the index.
+  std::vector<size_t> counts(4);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < counts.size(); i++) {
+    threads.emplace_back([&, i] {
+      counts[i] = block
+                      ->queryRegion(nullptr,
+                                    Rect(0, 0, 500, 500),
+                                    dbRegionQueryShape::INST)
+                      .size();
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (size_t count : counts) {
+    BOOST_TEST(count == 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_shapes)
+{
+  dbDatabase* db = create2LevetDbWithBTerms();
+  dbBlock* block = db->getChip()->getBlock();
+  dbTechLayer* layer = db->getTech()->findLayer("L1");
+  dbNet* net = block->findNet("n1");
+
+  dbSWire* swire = dbSWire::create(net, dbWireType::ROUTED);
+  dbSBox* sbox = dbSBox::create(
+      swire, layer, 0, 0, 1000, 100, dbWireShapeType::STRIPE);
+  dbObstruction::create(block, layer, 2000, 0, 3000, 1000);
+
+  auto shapes = block->queryRegion(layer, Rect(0, 0, 3000, 1000));
+  BOOST_TEST(shapes.size() == 2);
+
+  // Shapes added after the first query are picked up.
+  dbBPin* bpin = dbBPin::create(block->findBTerm("IN1"));
+  dbBox::create(bpin, layer, 500, 500, 600, 600);
+  dbSBox::create(swire, layer, 0, 200, 1000, 300, dbWireShapeType::STRIPE);
+  shapes = block->queryRegion(layer, Rect(0, 0, 1000, 1000));
+  BOOST_TEST(shapes.size() == 3);
+
+  shapes = block->queryRegion(
+      layer, Rect(500, 500, 600, 600), dbRegionQueryShape::BPIN);
+  BOOST_TEST(shapes.size() == 1);
+  BOOST_TEST(shapes[0].object == bpin);
+  BOOST_TEST(shapes[0].layer == layer);
+
+  dbSBox::destroy(sbox);
+  shapes = block->queryRegion(
+      layer, Rect(0, 0, 1000, 100), dbRegionQueryShape::SWIRE);
+  BOOST_TEST(shapes.empty());
+
+  dbSWire::destroy(swire);
+  shapes = block->queryRegion(
+      nullptr, Rect(0, 0, 3000, 1000), dbRegionQueryShape::SWIRE);
+  BOOST_TEST(shapes.empty());
+}
+
+static void addPath(dbWire* wire, dbTechLayer* layer, int y)
+{
+  dbWireEncoder encoder;
+  encoder.begin(wire);
+  encoder.newPath(layer, dbWireType::ROUTED);
+  encoder.addPoint(0, y);
+  encoder.addPoint(2000, y);
+  encoder.end();
+}
+
+BOOST_AUTO_TEST_CASE(test_wires)
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  dbBlock* block = db->getChip()->getBlock();
+  dbTechLayer* layer
+      = dbTechLayer::create(db->getTech(), "M1", dbTechLayerType::ROUTING);
+  layer->setWidth(100);
+  dbNet* n1 = block->findNet("n1");
+  dbNet* n2 = block->findNet("n2");
+
+  dbWire* wire = dbWire::create(n1);
+  addPath(wire, layer, 0);
+  auto shapes = block->queryRegion(
+      layer, Rect(900, 0, 1100, 0), dbRegionQueryShape::WIRE);
+  BOOST_TEST(shapes.size() == 1);
+  BOOST_TEST(shapes[0].object == n1);
+  BOOST_TEST(shapes[0].layer == layer);
+
+  // Global routes are not indexed, whether they exist when the index is
+  // built or are encoded afterwards.
+  addPath(dbWire::create(n2, true), layer, 4000);
+  shapes = block->queryRegion(
+      nullptr, Rect(0, 4000, 2000, 4000), dbRegionQueryShape::WIRE);
+  BOOST_TEST(shapes.empty());
+  block->releaseRegionQuery();
+  shapes = block->queryRegion(
+      nullptr, Rect(0, 4000, 2000, 4000), dbRegionQueryShape::WIRE);
+  BOOST_TEST(shapes.empty());
+
+  // Raw wire data replaces the shapes of the wire.
+  dbWire* other = dbWire::create(n2);
+  addPath(other, layer, 8000);
+  std::vector<int> data;
+  std::vector<unsigned char> op_codes;
+  other->getRawWireData(data, op_codes);
+  dbWire::destroy(other);
+  wire->setRawWireData(data, op_codes);
+  shapes = block->queryRegion(
+      layer, Rect(0, 0, 2000, 0), dbRegionQueryShape::WIRE);
+  BOOST_TEST(shapes.empty());
+  shapes = block->queryRegion(
+      layer, Rect(0, 8000, 2000, 8000), dbRegionQueryShape::WIRE);
+  BOOST_TEST(shapes.size() == 1);
+  BOOST_TEST(shapes[0].object == n1);
+
+  dbWire::destroy(wire);
+  shapes = block->queryRegion(
+      nullptr, Rect(0, 0, 2000, 8000), dbRegionQueryShape::WIRE);
+  BOOST_TEST(shapes.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
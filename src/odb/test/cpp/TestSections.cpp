@@ -0,0 +1,99 @@
+#define BOOST_TEST_MODULE TestSections
+#include <unistd.h>
+
+#include <boost/test/included/unit_test.hpp>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "helper.h"
+#include "odb/db.h"
+#include "utl/Logger.h"
+
+namespace odb {
+namespace {
+
+std::string writeToString(dbDatabase* db, int threads, bool compress)
+{
+  std::ostringstream stream;
+  db->write(stream, threads, compress);
+  return stream.str();
+}
+
+dbDatabase* readFromString(const std::string& data, int threads)
+{
+  std::istringstream stream(data);
+  dbDatabase* db = dbDatabase::create();
+  db->setLogger(new utl::Logger());
+  db->read(stream, threads);
+  return db;
+}
+
+BOOST_AUTO_TEST_SUITE(test_suite)
+
+BOOST_AUTO_TEST_CASE(test_threads_do_not_change_file)
+{
+  dbDatabase* db = createRoutedDB();
+  BOOST_TEST(writeToString(db, 4, false) == writeToString(db, 1, false));
+  BOOST_TEST(writeToString(db, 4, true) == writeToString(db, 1, true));
+}
+
+BOOST_AUTO_TEST_CASE(test_compressed_round_trip)
+{
+  dbDatabase* db = createRoutedDB();
+  const std::string plain = writeToString(db, 1, false);
+
+  for (int threads : {1, 4}) {
+    dbDatabase* read = readFromString(writeToString(db, 4, true), threads);
+    BOOST_TEST(writeToString(read, 1, false) == plain);
+    dbDatabase::destroy(read);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_multi_chunk_round_trip)
+{
+  // Large enough for the sections to be compressed in several chunks.
+  dbDatabase* db = createRoutedDB();
+  dbBlock* block = db->getChip()->getBlock();
+  for (int i = 0; i < 50000; i++) {
+    dbNet* net = dbNet::create(block, ("net" + std::to_string(i)).c_str());
+    dbIntProperty::create(net, "weight", i);
+  }
+  const std::string plain = writeToString(db, 1, false);
+
+  dbDatabase* read = readFromString(writeToString(db, 2, true), 2);
+  BOOST_TEST(writeToString(read, 1, false) == plain);
+  dbDatabase::destroy(read);
+}
+
+BOOST_AUTO_TEST_CASE(test_compressed_mapped_read)
+{
+  dbDatabase* db = createRoutedDB();
+
+  char path[] = "/tmp/TestSectionsXXXXXX";
+  close(mkstemp(path));
+  {
+    std::ofstream file(path, std::ios::binary);
+    db->write(file, 2, true);
+  }
+
+  dbDatabase* mapped = dbDatabase::create();
+  mapped->setLogger(new utl::Logger());
+  mapped->readMapped(path, 2);
+
+  dbNet* net = mapped->getChip()->getBlock()->findNet("n1");
+  BOOST_TEST(net->getGuides().size() == 1);
+  BOOST_TEST(net->getWire()->getLength() == 100);
+  BOOST_TEST(dbIntProperty::find(net, "weight")->getValue() == 3);
+  BOOST_TEST(net->getCapNodes().size() == 1);
+
+  BOOST_TEST(writeToString(mapped, 1, false) == writeToString(db, 1, false));
+
+  std::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace
+}  // namespace odb
@@ -33,6 +33,7 @@
 #include "helper.h"
 
 #include "odb/db.h"
+#include "odb/dbWireCodec.h"
 #include "utl/Logger.h"
 
 namespace odb {
@@ -117,4 +118,26 @@ dbDatabase* create2LevetDbWithBTerms()
   return db;
 }
 
+dbDatabase* createRoutedDB()
+{
+  dbDatabase* db = create2LevetDbNoBTerms();
+  dbBlock* block = db->getChip()->getBlock();
+  dbTechLayer* layer = db->getTech()->findLayer("L1");
+
+  for (dbNet* net : block->getNets()) {
+    dbGuide::create(net, layer, {0, 0, 100, 100});
+    dbIntProperty::create(net, "weight", 3);
+    dbCapNode::create(net, 1, false);
+
+    dbWire* wire = dbWire::create(net);
+    dbWireEncoder encoder;
+    encoder.begin(wire);
+    encoder.newPath(layer, dbWireType::ROUTED);
+    encoder.addPoint(0, 50);
+    encoder.addPoint(100, 50);
+    encoder.end();
+  }
+  return db;
+}
+
 }  // namespace odb
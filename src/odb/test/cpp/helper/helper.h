@@ -59,4 +59,8 @@ odb::dbDatabase* create2LevetDbNoBTerms();
 
 odb::dbDatabase* create2LevetDbWithBTerms();
 
+// create2LevetDbNoBTerms with a guide, a property, a cap node and a
+// routed wire on every net.
+odb::dbDatabase* createRoutedDB();
+
 }  // namespace odb
@@ -510,6 +510,9 @@ void ICeWall::placePad(odb::dbMaster* master,
   }
 
   placeInstance(row, snapToRowSite(row, location), inst, orient.getOrient());
+  // the overlap check built the block's region query, which is updated on
+  // every later edit until it is released
+  block->releaseRegionQuery();
 }
 
 int ICeWall::snapToRowSite(odb::dbRow* row, int location) const
@@ -642,36 +645,45 @@ void ICeWall::placeInstance(odb::dbRow* row,
                    row_bbox.yMax() / dbus);
   }
 
-  // check for overlaps with other instances
-  for (auto* check_inst : block->getInsts()) {
-    if (check_inst == inst) {
-      continue;
-    }
-    if (!check_inst->isFixed()) {
-      continue;
-    }
-    const odb::Rect check_rect = check_inst->getBBox()->getBox();
-    if (!allow_overlap && inst_rect.overlaps(check_rect)) {
-      logger_->error(utl::PAD,
-                     1,
-                     "Unable to place {} ({}) at ({:.3f}um, {:.3f}um) - "
-                     "({:.3f}um, {:.3f}um) as it "
-                     "overlaps with {} ({}) at ({:.3f}um, {:.3f}um) - "
-                     "({:.3f}um, {:.3f}um)",
-                     inst->getName(),
-                     inst->getMaster()->getName(),
-                     inst_rect.xMin() / dbus,
-                     inst_rect.yMin() / dbus,
-                     inst_rect.xMax() / dbus,
-                     inst_rect.yMax() / dbus,
-                     check_inst->getName(),
-                     check_inst->getMaster()->getName(),
-                     check_rect.xMin() / dbus,
-                     check_rect.yMin() / dbus,
-                     check_rect.xMax() / dbus,
-                     check_rect.yMax() / dbus);
+  // check for overlaps with other instances, reporting the first one in
+  // block order
+  odb::dbInst* overlap_inst = nullptr;
+  if (!allow_overlap) {
+    for (const odb::dbRegionQueryShape& shape : block->queryRegion(
+             nullptr, inst_rect, odb::dbRegionQueryShape::INST)) {
+      auto* check_inst = static_cast<odb::dbInst*>(shape.object);
+      if (check_inst == inst || !check_inst->isFixed()
+          || !inst_rect.overlaps(shape.box)) {
+        continue;
+      }
+      if (overlap_inst == nullptr
+          || check_inst->getId() < overlap_inst->getId()) {
+        overlap_inst = check_inst;
+      }
     }
   }
+  if (overlap_inst != nullptr) {
+    block->releaseRegionQuery();
+    const odb::Rect check_rect = overlap_inst->getBBox()->getBox();
+    logger_->error(utl::PAD,
+                   1,
+                   "Unable to place {} ({}) at ({:.3f}um, {:.3f}um) - "
+                   "({:.3f}um, {:.3f}um) as it "
+                   "overlaps with {} ({}) at ({:.3f}um, {:.3f}um) - "
+                   "({:.3f}um, {:.3f}um)",
+                   inst->getName(),
+                   inst->getMaster()->getName(),
+                   inst_rect.xMin() / dbus,
+                   inst_rect.yMin() / dbus,
+                   inst_rect.xMax() / dbus,
+                   inst_rect.yMax() / dbus,
+                   overlap_inst->getName(),
+                   overlap_inst->getMaster()->getName(),
+                   check_rect.xMin() / dbus,
+                   check_rect.yMin() / dbus,
+                   check_rect.xMax() / dbus,
+                   check_rect.yMax() / dbus);
+  }
   inst->setPlacementStatus(odb::dbPlacementStatus::FIRM);
 }
 
@@ -768,6 +780,7 @@ void ICeWall::placeFiller(
     const int width = it->upper() - it->lower();
     const int start = it->lower();
     if (width % site_width != 0) {
+      block->releaseRegionQuery();
       logger_->error(utl::PAD,
                      26,
                      "Filling {} ({:.3f}um -> {:.3f}um) will result in a gap.",
@@ -844,6 +857,7 @@ void ICeWall::placeFiller(
     }
 
     if (sites > 0) {
+      block->releaseRegionQuery();
       logger_->error(
           utl::PAD,
           30,
@@ -854,6 +868,7 @@ void ICeWall::placeFiller(
     }
     fill_group++;
   }
+  block->releaseRegionQuery();
 }
 
 void ICeWall::removeFiller(odb::dbRow* row)
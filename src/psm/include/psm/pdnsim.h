@@ -69,6 +69,16 @@ enum class GeneratedSourceType
   BUMPS
 };
 
+// How the G matrix of the power grid is solved.  CHOLESKY and CG solve the
+// symmetric positive definite system left after the source nodes are
+// eliminated.
+enum class SolverType
+{
+  LU,
+  CHOLESKY,
+  CG
+};
+
 class PDNSim : public odb::dbBlockCallBackObj
 {
  public:
@@ -103,7 +113,8 @@ class PDNSim : public odb::dbBlockCallBackObj
                         bool enable_em,
                         const std::string& em_file,
                         const std::string& error_file,
-                        const std::string& voltage_source_file);
+                        const std::string& voltage_source_file,
+                        SolverType solver_type = SolverType::LU);
   void writeSpiceNetwork(odb::dbNet* net,
                          sta::Corner* corner,
                          GeneratedSourceType source_type,
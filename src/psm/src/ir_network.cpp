@@ -1182,7 +1182,7 @@ void IRNetwork::copy(Node* keep,
   remove_connections.shrink_to_fit();
 }
 
-void IRNetwork::dumpNodes(const std::map<Node*, std::size_t>& node_map,
+void IRNetwork::dumpNodes(const std::vector<Node*>& nodes,
                           const std::string& name) const
 {
   const std::string report_file = fmt::format("psm_{}.txt", name);
@@ -1192,27 +1192,21 @@ void IRNetwork::dumpNodes(const std::map<Node*, std::size_t>& node_map,
     return;
   }
 
-  std::map<std::size_t, Node*> nodeidx_map;
-  for (const auto& [node, idx] : node_map) {
-    nodeidx_map[idx] = node;
-  }
-
-  for (const auto& [idx, node] : nodeidx_map) {
-    report << std::to_string(idx) << ": " << node->describe("") << '\n';
+  for (std::size_t idx = 0; idx < nodes.size(); idx++) {
+    report << std::to_string(idx) << ": " << nodes[idx]->describe("") << '\n';
   }
 }
 
 void IRNetwork::dumpNodes(const std::string& name) const
 {
-  std::map<Node*, std::size_t> node_idx;
-  std::size_t idx = 0;
+  std::vector<Node*> nodes;
   for (const auto& [layer, layer_nodes] : nodes_) {
     for (const auto& node : layer_nodes) {
-      node_idx[node.get()] = idx++;
+      nodes.push_back(node.get());
     }
   }
 
-  dumpNodes(node_idx, name);
+  dumpNodes(nodes, name);
 }
 
 bool IRNetwork::belongsTo(Node* node) const
@@ -138,7 +138,8 @@ class IRNetwork
   std::map<odb::dbInst*, Node::NodeSet> getInstanceNodeMapping() const;
 
   // For debug only
-  void dumpNodes(const std::map<Node*, std::size_t>& node_map,
+  // Writes each node with its position in nodes as its index
+  void dumpNodes(const std::vector<Node*>& nodes,
                  const std::string& name = "nodes") const;
   void dumpNodes(const std::string& name = "nodes") const;
 
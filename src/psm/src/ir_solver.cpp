@@ -32,6 +32,8 @@
 
 #include "ir_solver.h"
 
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/SparseCholesky>
 #include <Eigen/SparseLU>
 #include <fstream>
 #include <list>
@@ -759,62 +761,79 @@ std::map<Node*, Connection::ConnectionSet> IRSolver::getNodeConnectionMap(
   return node_connections;
 }
 
-std::map<Node*, std::size_t> IRSolver::assignNodeIDs(const Node::NodeSet& nodes,
-                                                     std::size_t start) const
+std::vector<Node*> IRSolver::assignNodeIDs(
+    const Node::NodeSet& nodes,
+    const std::vector<std::unique_ptr<SourceNode>>& sources,
+    bool eliminate_sources,
+    std::size_t& num_unknowns) const
 {
-  std::size_t idx = start;
-  std::map<Node*, std::size_t> node_index;
-  for (auto* node : nodes) {
-    node_index[node] = idx++;
+  std::vector<Node*> node_order;
+  node_order.reserve(nodes.size() + sources.size());
+
+  if (eliminate_sources) {
+    // Nodes driven by a source have a known voltage and are numbered after
+    // the unknowns so they drop out of G.
+    std::set<Node*> fixed;
+    for (const auto& src_node : sources) {
+      fixed.insert(src_node->getSource());
+    }
+    for (auto* node : nodes) {
+      if (fixed.find(node) == fixed.end()) {
+        node_order.push_back(node);
+      }
+    }
+    num_unknowns = node_order.size();
+    for (auto* node : nodes) {
+      if (fixed.find(node) != fixed.end()) {
+        node_order.push_back(node);
+      }
+    }
+  } else {
+    node_order.insert(node_order.end(), nodes.begin(), nodes.end());
+    Node::NodeSet src_set;
+    for (const auto& src_node : sources) {
+      src_set.insert(src_node.get());
+    }
+    node_order.insert(node_order.end(), src_set.begin(), src_set.end());
+    num_unknowns = node_order.size();
   }
-  return node_index;
-}
 
-std::map<Node*, std::size_t> IRSolver::assignNodeIDs(
-    const std::vector<std::unique_ptr<SourceNode>>& nodes,
-    std::size_t start) const
-{
-  Node::NodeSet node_set;
-  for (const auto& node : nodes) {
-    node_set.insert(node.get());
+  for (std::size_t idx = 0; idx < node_order.size(); idx++) {
+    node_order[idx]->setIndex(idx);
   }
-  return assignNodeIDs(node_set, start);
+
+  return node_order;
 }
 
-void IRSolver::buildCondMatrixAndVoltages(
-    bool is_ground,
+void IRSolver::buildCondMatrix(
     const std::map<Node*, Connection::ConnectionSet>& node_connections,
-    const ValueNodeMap<Current>& currents,
     const std::map<psm::Connection*, Connection::Conductance>& conductance,
-    const std::map<Node*, std::size_t>& node_index,
-    Eigen::SparseMatrix<Connection::Conductance>& G,
-    Eigen::VectorXd& J) const
+    std::size_t num_unknowns,
+    Eigen::SparseMatrix<Connection::Conductance>& G) const
 {
   const utl::DebugScopedTimer timer(
-      logger_, utl::PSM, "timer", 1, "Build G and J: {}");
+      logger_, utl::PSM, "timer", 1, "Build G: {}");
 
   const bool print_progress = logger_->debugCheck(utl::PSM, "progress", 1);
   std::size_t count = 0;
   std::vector<Eigen::Triplet<Connection::Conductance>> cond_values;
   for (const auto& [node, connections] : node_connections) {
-    const std::size_t node_idx = node_index.at(node);
-
-    auto find_node = currents.find(node);
-    if (find_node == currents.end()) {
-      J[node_idx] = 0;
-    } else {
-      J[node_idx] = find_node->second;
+    const std::size_t node_idx = node->getIndex();
+    if (node_idx >= num_unknowns) {
+      continue;
     }
 
     Connection::Conductance node_cond = 0.0;
     for (auto* conn : connections) {
       Node* other = conn->getOtherNode(node);
-      const std::size_t other_idx = node_index.at(other);
+      const std::size_t other_idx = other->getIndex();
 
       const Connection::Conductance cond = conductance.at(conn);
       node_cond += cond;
 
-      cond_values.emplace_back(node_idx, other_idx, -cond);
+      if (other_idx < num_unknowns) {
+        cond_values.emplace_back(node_idx, other_idx, -cond);
+      }
     }
     cond_values.emplace_back(node_idx, node_idx, node_cond);
     if (print_progress && count % 1000 == 0) {
@@ -824,33 +843,63 @@ void IRSolver::buildCondMatrixAndVoltages(
     count++;
   }
   G.setFromTriplets(cond_values.begin(), cond_values.end());
+}
+
+void IRSolver::buildVoltages(
+    bool is_ground,
+    Voltage src_voltage,
+    const std::map<Node*, Connection::ConnectionSet>& node_connections,
+    const ValueNodeMap<Current>& currents,
+    const std::map<psm::Connection*, Connection::Conductance>& conductance,
+    std::size_t num_unknowns,
+    Eigen::VectorXd& J) const
+{
+  const utl::DebugScopedTimer timer(
+      logger_, utl::PSM, "timer", 1, "Build J: {}");
+
+  // Current injected through the conductances to nodes with a known voltage
+  Eigen::VectorXd J_fixed = Eigen::VectorXd::Zero(J.size());
+  for (const auto& [node, connections] : node_connections) {
+    const std::size_t node_idx = node->getIndex();
+    if (node_idx >= num_unknowns) {
+      continue;
+    }
+
+    auto find_node = currents.find(node);
+    if (find_node == currents.end()) {
+      J[node_idx] = 0;
+    } else {
+      J[node_idx] = find_node->second;
+    }
+
+    for (auto* conn : connections) {
+      Node* other = conn->getOtherNode(node);
+      if (other->getIndex() >= num_unknowns) {
+        J_fixed[node_idx] += conductance.at(conn) * src_voltage;
+      }
+    }
+  }
   if (!is_ground) {
     for (auto& j : J) {
       j = -j;
     }
   }
-  cond_values.clear();
+  J += J_fixed;
 }
 
-void IRSolver::addSourcesToMatrixAndVoltages(
-    Voltage src_voltage,
+void IRSolver::addSourcesToMatrix(
     const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
-    const std::map<Node*, std::size_t>& node_index,
-    Eigen::SparseMatrix<Connection::Conductance>& G,
-    Eigen::VectorXd& J) const
+    Eigen::SparseMatrix<Connection::Conductance>& G) const
 {
   // Attach sources as current sources through a 1 ohm resistor
-  constexpr Connection::Resistance src_res = 1.0;
-  const Connection::Conductance src_cond = 1.0 / src_res;
+  const Connection::Conductance src_cond = 1.0 / source_resistance_;
 
   for (const auto& src_node : sources) {
-    const std::size_t idx = node_index.at(src_node.get());
-
-    J[idx] = src_voltage / src_res;
+    const std::size_t idx = src_node->getIndex();
 
     Node* real_node = src_node->getSource();
 
-    const std::size_t real_node_idx = node_index.at(real_node);
+    const std::size_t real_node_idx = real_node->getIndex();
 
     debugPrint(logger_,
                utl::PSM,
@@ -865,58 +914,150 @@ void IRSolver::addSourcesToMatrixAndVoltages(
   }
 }
 
-void IRSolver::solve(sta::Corner* corner,
-                     GeneratedSourceType source_type,
-                     const std::string& source_file)
+void IRSolver::addSourcesToVoltages(
+    Voltage src_voltage,
+    const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
+    Eigen::VectorXd& J) const
 {
-  const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
+  for (const auto& src_node : sources) {
+    J[src_node->getIndex()] = src_voltage / source_resistance_;
+  }
+}
 
-  if (network_->isFloorplanningOnly()) {
-    network_->setFloorplanning(false);
-    network_->construct();
+static std::string getSolverMessage(
+    const Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>>&
+        solver)
+{
+  return solver.lastErrorMessage();
+}
+
+template <typename Solver>
+static std::string getSolverMessage(const Solver& solver)
+{
+  switch (solver.info()) {
+    case Eigen::ComputationInfo::Success:
+      return "success";
+    case Eigen::ComputationInfo::NumericalIssue:
+      return "matrix is not positive definite";
+    case Eigen::ComputationInfo::NoConvergence:
+      return "no convergence";
+    case Eigen::ComputationInfo::InvalidInput:
+      return "invalid input";
+  }
+  return "unknown";
+}
+
+// Eigen solver behind a common interface so that its factorization can be
+// kept between solves.
+class GFactorization
+{
+ public:
+  virtual ~GFactorization() = default;
+
+  virtual void compute(
+      const Eigen::SparseMatrix<Connection::Conductance>& G)
+      = 0;
+  virtual Eigen::VectorXd solve(const Eigen::VectorXd& J) = 0;
+  virtual Eigen::ComputationInfo info() const = 0;
+  virtual std::string getMessage() const = 0;
+};
+
+template <typename Solver>
+class EigenFactorization : public GFactorization
+{
+ public:
+  Solver& getSolver() { return solver_; }
+
+  void compute(const Eigen::SparseMatrix<Connection::Conductance>& G) override
+  {
+    solver_.compute(G);
   }
+  Eigen::VectorXd solve(const Eigen::VectorXd& J) override
+  {
+    return solver_.solve(J);
+  }
+  Eigen::ComputationInfo info() const override { return solver_.info(); }
+  std::string getMessage() const override { return getSolverMessage(solver_); }
 
-  // Reset
-  auto& voltages = voltages_[corner];
-  auto& currents = currents_[corner];
+ private:
+  Solver solver_;
+};
 
-  voltages.clear();
-  currents.clear();
+struct IRSolver::System
+{
+  // What G was built from
+  Connection::ResistanceMap resistance;
+  std::vector<Node*> source_nodes;
+  SolverType solver_type;
+
+  std::map<Connection*, Connection::Conductance> conductance;
+  std::map<Node*, Connection::ConnectionSet> node_connections;
+  std::vector<std::unique_ptr<SourceNode>> sources;
+  // Nodes by their index in G
+  std::vector<Node*> nodes;
+  std::size_t num_unknowns = 0;
+  Eigen::SparseMatrix<Connection::Conductance> G;
+  // Iterative solvers keep a reference to G
+  std::unique_ptr<GFactorization> factorization;
+};
+
+IRSolver::~IRSolver() = default;
+
+bool IRSolver::isSystemValid(
+    const Connection::ResistanceMap& resistance,
+    const std::vector<std::unique_ptr<SourceNode>>& sources,
+    SolverType solver_type) const
+{
+  if (system_ == nullptr || system_->solver_type != solver_type
+      || system_->resistance != resistance
+      || system_->source_nodes.size() != sources.size()) {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < sources.size(); i++) {
+    if (system_->source_nodes[i] != sources[i]->getSource()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void IRSolver::buildSystem(sta::Corner* corner,
+                           const Connection::ResistanceMap& resistance,
+                           std::vector<std::unique_ptr<SourceNode>> sources,
+                           SolverType solver_type)
+{
+  auto system = std::make_unique<System>();
+  system->resistance = resistance;
+  system->solver_type = solver_type;
+  for (const auto& src_node : sources) {
+    system->source_nodes.push_back(src_node->getSource());
+  }
 
-  const auto conductance = generateConductanceMap(corner);
+  system->conductance = generateConductanceMap(corner);
   debugPrint(logger_,
              utl::PSM,
              "stats",
              1,
              "Connections in conductance map: {}",
-             conductance.size());
+             system->conductance.size());
 
   if (logger_->debugCheck(utl::PSM, "dump", 2)) {
-    dumpConductance(conductance, "cond");
+    dumpConductance(system->conductance, "cond");
   }
 
-  const auto node_connections = getNodeConnectionMap(conductance);
+  system->node_connections = getNodeConnectionMap(system->conductance);
   Node::NodeSet all_nodes;
-  for (const auto& [node, conns] : node_connections) {
+  for (const auto& [node, conns] : system->node_connections) {
     all_nodes.insert(node);
   }
 
-  buildNodeCurrentMap(corner, currents);
-
-  // Build source map
-  std::vector<std::unique_ptr<SourceNode>> src_nodes;
-  Voltage src_voltage
-      = generateSourceNodes(source_type, source_file, corner, src_nodes);
-
-  // Solve
-  // create vector of nodes
-  std::map<Node*, std::size_t> node_index = assignNodeIDs(all_nodes);
-  const std::map<Node*, std::size_t> real_node_index = node_index;
-  for (const auto& [node, id] : assignNodeIDs(src_nodes, node_index.size())) {
-    node_index[node] = id;
-  }
-
-  const std::size_t num_nodes = node_index.size();
+  // LU solves the sources as part of the system, the symmetric solvers
+  // need them folded into J.
+  const bool eliminate_sources = solver_type != SolverType::LU;
+  system->nodes = assignNodeIDs(
+      all_nodes, sources, eliminate_sources, system->num_unknowns);
+  system->sources = std::move(sources);
 
   debugPrint(logger_,
              utl::PSM,
@@ -924,46 +1065,116 @@ void IRSolver::solve(sta::Corner* corner,
              1,
              "Nodes in all nodes: {}",
              all_nodes.size());
-  debugPrint(logger_, utl::PSM, "stats", 1, "Nodes in matrix: {}", num_nodes);
-
-  // create sparse matrix and vector
-  Eigen::SparseMatrix<Connection::Conductance> G(num_nodes, num_nodes);
-  Eigen::VectorXd J(num_nodes);
-
-  // Build G and J
-  buildCondMatrixAndVoltages(src_voltage == 0.0,
-                             node_connections,
-                             currents,
-                             conductance,
-                             node_index,
-                             G,
-                             J);
-  addSourcesToMatrixAndVoltages(src_voltage, src_nodes, node_index, G, J);
-
-  Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>> eigen_solver;
+  debugPrint(logger_,
+             utl::PSM,
+             "stats",
+             1,
+             "Nodes in matrix: {}",
+             system->num_unknowns);
+
+  system->G.resize(system->num_unknowns, system->num_unknowns);
+  buildCondMatrix(system->node_connections,
+                  system->conductance,
+                  system->num_unknowns,
+                  system->G);
+  if (!eliminate_sources) {
+    addSourcesToMatrix(system->sources, system->G);
+  }
+
+  switch (solver_type) {
+    case SolverType::LU:
+      system->factorization = std::make_unique<EigenFactorization<
+          Eigen::SparseLU<Eigen::SparseMatrix<Connection::Conductance>>>>();
+      break;
+    case SolverType::CHOLESKY:
+      system->factorization
+          = std::make_unique<EigenFactorization<Eigen::SimplicialLDLT<
+              Eigen::SparseMatrix<Connection::Conductance>>>>();
+      break;
+    case SolverType::CG: {
+      auto cg = std::make_unique<EigenFactorization<Eigen::ConjugateGradient<
+          Eigen::SparseMatrix<Connection::Conductance>,
+          Eigen::Lower | Eigen::Upper,
+          Eigen::IncompleteCholesky<Connection::Conductance>>>>();
+      cg->getSolver().setTolerance(cg_tolerance_);
+      system->factorization = std::move(cg);
+      break;
+    }
+  }
 
   debugPrint(logger_, utl::PSM, "solve", 1, "Factorizing the G matrix");
-  eigen_solver.compute(G);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+  system->factorization->compute(system->G);
+  if (system->factorization->info() != Eigen::ComputationInfo::Success) {
     // decomposition failed
     if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
+      network_->dumpNodes(system->nodes);
+      dumpMatrix(system->G, "G");
     }
-    logger_->error(
-        utl::PSM,
-        10,
-        "LU factorization of the G Matrix failed. SparseLU solver message: {}.",
-        eigen_solver.lastErrorMessage());
+    logger_->error(utl::PSM,
+                   10,
+                   "Factorization of the G Matrix failed. Solver message: {}.",
+                   system->factorization->getMessage());
+  }
+
+  system_ = std::move(system);
+}
+
+void IRSolver::solve(sta::Corner* corner,
+                     GeneratedSourceType source_type,
+                     const std::string& source_file,
+                     SolverType solver_type)
+{
+  const utl::DebugScopedTimer timer(logger_, utl::PSM, "timer", 1, "Solve: {}");
+
+  if (network_->isFloorplanningOnly()) {
+    network_->setFloorplanning(false);
+    network_->construct();
+    system_ = nullptr;
+  }
+
+  // Reset
+  auto& voltages = voltages_[corner];
+  auto& currents = currents_[corner];
+
+  voltages.clear();
+  currents.clear();
+
+  buildNodeCurrentMap(corner, currents);
+
+  // Build source map
+  std::vector<std::unique_ptr<SourceNode>> src_nodes;
+  Voltage src_voltage
+      = generateSourceNodes(source_type, source_file, corner, src_nodes);
+
+  // Corners with the same resistances and sources only differ in J
+  const Connection::ResistanceMap resistance = getResistanceMap(corner);
+  if (isSystemValid(resistance, src_nodes, solver_type)) {
+    debugPrint(
+        logger_, utl::PSM, "solve", 1, "Reusing the factorized G matrix");
+  } else {
+    buildSystem(corner, resistance, std::move(src_nodes), solver_type);
+  }
+  const System& system = *system_;
+
+  Eigen::VectorXd J(system.num_unknowns);
+  buildVoltages(src_voltage == 0.0,
+                src_voltage,
+                system.node_connections,
+                currents,
+                system.conductance,
+                system.num_unknowns,
+                J);
+  if (system.solver_type == SolverType::LU) {
+    addSourcesToVoltages(src_voltage, system.sources, J);
   }
 
   debugPrint(logger_, utl::PSM, "solve", 1, "Solving system of equations GV=J");
-  const Eigen::VectorXd V = eigen_solver.solve(J);
-  if (eigen_solver.info() != Eigen::ComputationInfo::Success) {
+  const Eigen::VectorXd V = system.factorization->solve(J);
+  if (system.factorization->info() != Eigen::ComputationInfo::Success) {
     // solving failed
     if (logger_->debugCheck(utl::PSM, "dump", 1)) {
-      network_->dumpNodes(node_index);
-      dumpMatrix(G, "G");
+      network_->dumpNodes(system.nodes);
+      dumpMatrix(system.G, "G");
       dumpVector(J, "J");
     }
     logger_->error(utl::PSM, 12, "Solving V = inv(G)*J failed.");
@@ -975,13 +1186,14 @@ void IRSolver::solve(sta::Corner* corner,
              "Solving system of equations GV=J complete");
 
   if (logger_->debugCheck(utl::PSM, "dump", 2)) {
-    network_->dumpNodes(node_index);
-    dumpMatrix(G, "G");
+    network_->dumpNodes(system.nodes);
+    dumpMatrix(system.G, "G");
     dumpVector(J, "J");
     dumpVector(V, "V");
   }
-  for (const auto& [node, node_idx] : real_node_index) {
-    voltages[node] = V[node_idx];
+  for (const auto& [node, connections] : system.node_connections) {
+    const std::size_t node_idx = node->getIndex();
+    voltages[node] = node_idx < system.num_unknowns ? V[node_idx] : src_voltage;
   }
   solution_voltages_[corner] = src_voltage;
 }
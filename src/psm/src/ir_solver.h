@@ -95,6 +95,7 @@ class IRSolver
            const std::map<odb::dbNet*, std::map<sta::Corner*, Voltage>>&
                user_voltages,
            const PDNSim::GeneratedSourceSettings& generated_source_settings);
+  ~IRSolver();
 
   odb::dbNet* getNet() const { return net_; };
 
@@ -102,7 +103,8 @@ class IRSolver
 
   void solve(sta::Corner* corner,
              GeneratedSourceType source_type,
-             const std::string& source_file);
+             const std::string& source_file,
+             SolverType solver_type = SolverType::LU);
 
   void report(sta::Corner* corner) const;
   void reportEM(sta::Corner* corner) const;
@@ -192,25 +194,38 @@ class IRSolver
       const;
   void buildNodeCurrentMap(sta::Corner* corner,
                            ValueNodeMap<Current>& currents) const;
-  std::map<Node*, std::size_t> assignNodeIDs(const Node::NodeSet& nodes,
-                                             std::size_t start = 0) const;
-  std::map<Node*, std::size_t> assignNodeIDs(
-      const std::vector<std::unique_ptr<SourceNode>>& nodes,
-      std::size_t start = 0) const;
-  void buildCondMatrixAndVoltages(
+  std::vector<Node*> assignNodeIDs(
+      const Node::NodeSet& nodes,
+      const std::vector<std::unique_ptr<SourceNode>>& sources,
+      bool eliminate_sources,
+      std::size_t& num_unknowns) const;
+  void buildCondMatrix(
+      const std::map<Node*, Connection::ConnectionSet>& node_connections,
+      const std::map<psm::Connection*, Connection::Conductance>& conductance,
+      std::size_t num_unknowns,
+      Eigen::SparseMatrix<Connection::Conductance>& G) const;
+  void buildVoltages(
       bool is_ground,
+      Voltage src_voltage,
       const std::map<Node*, Connection::ConnectionSet>& node_connections,
       const ValueNodeMap<Current>& currents,
       const std::map<psm::Connection*, Connection::Conductance>& conductance,
-      const std::map<Node*, std::size_t>& node_index,
-      Eigen::SparseMatrix<Connection::Conductance>& G,
+      std::size_t num_unknowns,
       Eigen::VectorXd& J) const;
-  void addSourcesToMatrixAndVoltages(
+  void addSourcesToMatrix(
+      const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
+      Eigen::SparseMatrix<Connection::Conductance>& G) const;
+  void addSourcesToVoltages(
       Voltage src_voltage,
       const std::vector<std::unique_ptr<psm::SourceNode>>& sources,
-      const std::map<Node*, std::size_t>& node_index,
-      Eigen::SparseMatrix<Connection::Conductance>& G,
       Eigen::VectorXd& J) const;
+  bool isSystemValid(const Connection::ResistanceMap& resistance,
+                     const std::vector<std::unique_ptr<SourceNode>>& sources,
+                     SolverType solver_type) const;
+  void buildSystem(sta::Corner* corner,
+                   const Connection::ResistanceMap& resistance,
+                   std::vector<std::unique_ptr<SourceNode>> sources,
+                   SolverType solver_type);
 
   std::string getMetricKey(const std::string& key, sta::Corner* corner) const;
 
@@ -243,7 +258,16 @@ class IRSolver
   std::map<sta::Corner*, ValueNodeMap<Voltage>> voltages_;
   std::map<sta::Corner*, ValueNodeMap<Current>> currents_;
 
+  // Factorized G of the last solve, reused by corners that share its
+  // resistances and sources
+  struct System;
+  std::unique_ptr<System> system_;
+
   static constexpr Current spice_file_min_current_ = 1e-18;
+  // Sources are attached to the grid through this resistance
+  static constexpr Connection::Resistance source_resistance_ = 1.0;
+  // Relative residual at which the CG solver stops
+  static constexpr double cg_tolerance_ = 1e-12;
 };
 
 }  // namespace psm
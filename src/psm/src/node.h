@@ -90,6 +90,10 @@ class Node
   std::string getName() const;
   std::string getTypeName() const;
 
+  // Row of the node in the G matrix of the last solve.
+  void setIndex(std::size_t index) { index_ = index; }
+  std::size_t getIndex() const { return index_; }
+
  protected:
   virtual NodeType getType() const { return NodeType::Node; }
 
@@ -100,6 +104,7 @@ class Node
 
   odb::Point pt_;
   odb::dbTechLayer* layer_;
+  std::size_t index_ = 0;
 };
 
 class SourceNode : public Node
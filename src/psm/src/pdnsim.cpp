@@ -96,14 +96,15 @@ void PDNSim::analyzePowerGrid(odb::dbNet* net,
                               bool enable_em,
                               const std::string& em_file,
                               const std::string& error_file,
-                              const std::string& voltage_source_file)
+                              const std::string& voltage_source_file,
+                              SolverType solver_type)
 {
   if (!checkConnectivity(net, false, error_file)) {
     return;
   }
 
   auto* solver = getIRSolver(net, false);
-  solver->solve(corner, source_type, voltage_source_file);
+  solver->solve(corner, source_type, voltage_source_file, solver_type);
   solver->report(corner);
 
   heatmap_->setNet(net);
@@ -67,6 +67,19 @@ using sta::Corner;
   }
 }
 
+%typemap(in) psm::SolverType {
+  int length;
+  const char *arg = Tcl_GetStringFromObj($input, &length);
+
+  if (strcmp(arg, "CHOLESKY") == 0) {
+    $1 = psm::SolverType::CHOLESKY;
+  } else if (strcmp(arg, "CG") == 0) {
+    $1 = psm::SolverType::CG;
+  } else {
+    $1 = psm::SolverType::LU;
+  }
+}
+
 %inline %{
 
 
@@ -78,10 +91,10 @@ set_net_voltage_cmd(odb::dbNet* net, Corner* corner, double voltage)
 }
 
 void 
-analyze_power_grid_cmd(odb::dbNet* net, Corner* corner, psm::GeneratedSourceType type, const char* error_file, bool enable_em, const char* em_file, const char* voltage_file, const char* voltage_source_file)
+analyze_power_grid_cmd(odb::dbNet* net, Corner* corner, psm::GeneratedSourceType type, const char* error_file, bool enable_em, const char* em_file, const char* voltage_file, const char* voltage_source_file, psm::SolverType solver_type)
 {
   PDNSim* pdnsim = getPDNSim();
-  pdnsim->analyzePowerGrid(net, corner, type, voltage_file, enable_em, em_file, error_file, voltage_source_file);
+  pdnsim->analyzePowerGrid(net, corner, type, voltage_file, enable_em, em_file, error_file, voltage_source_file, solver_type);
 }
 
 bool
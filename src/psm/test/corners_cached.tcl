@@ -0,0 +1,50 @@
+# A corner solved with the cached factorization of another corner
+# has to match a cold solve of the same corner.
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+define_corners "min" "max"
+read_liberty -corner max Nangate45/Nangate45_slow.lib
+read_liberty -corner min Nangate45/Nangate45_fast.lib
+read_sdc Nangate45_data/gcd.sdc
+
+# Give both corners the min resistances so that they share G.
+set stream [open Nangate45_data/Nangate45_corners.rc r]
+while { [gets $stream line] >= 0 } {
+  if { [string match "*-corner min *" $line] } {
+    eval $line
+    eval [string map {"-corner min" "-corner max"} $line]
+  }
+}
+close $stream
+
+set min_file [make_result_file corners_cached-min.rpt]
+set cached_file [make_result_file corners_cached-cached.rpt]
+set cold_file [make_result_file corners_cached-cold.rpt]
+
+analyze_power_grid -corner min -vsrc Vsrc_gcd_vdd.loc -net VDD \
+  -voltage_file $min_file
+analyze_power_grid -corner max -vsrc Vsrc_gcd_vdd.loc -net VDD \
+  -voltage_file $cached_file
+
+# Moving an instance drops the solvers, so the next solve starts cold.
+set inst [[ord::get_db_block] findInst _440_]
+set origin [$inst getOrigin]
+$inst setOrigin [expr { [lindex $origin 0] + 380 }] [lindex $origin 1]
+$inst setOrigin {*}$origin
+
+analyze_power_grid -corner max -vsrc Vsrc_gcd_vdd.loc -net VDD \
+  -voltage_file $cold_file
+
+# The corners draw different currents, otherwise the check proves nothing.
+if { ![diff_files $min_file $cached_file] } {
+  puts "min and max corners have the same voltages"
+  exit 1
+}
+if { [diff_files $cached_file $cold_file] } {
+  puts "cached and cold solves differ"
+  exit 1
+}
+puts "pass"
+exit
@@ -0,0 +1,15 @@
+source helpers.tcl
+
+read_lef Nangate45/Nangate45.lef
+read_def Nangate45_data/gcd.def
+read_liberty Nangate45/Nangate45_typ.lib
+read_sdc Nangate45_data/gcd.sdc
+
+foreach solver {CHOLESKY CG} {
+  set voltage_file [make_result_file gcd_test_vdd_solvers-$solver-voltage.rpt]
+
+  analyze_power_grid -vsrc Vsrc_gcd_vdd.loc -voltage_file $voltage_file -net VDD \
+    -solver $solver
+
+  diff_files $voltage_file gcd_test_vdd-voltage.rptok
+}
@@ -2,6 +2,7 @@ record_tests {
   aes_test_vdd
   aes_test_vss
   gcd_test_vdd
+  gcd_test_vdd_solvers
   gcd_no_vsrc
   gcd_write_sp_test_vdd
   gcd_all_vss
@@ -27,3 +28,7 @@ record_tests {
   #psm_man_tcl_check
   #psm_readme_msgs_check
 }
+
+record_pass_fail_tests {
+  corners_cached
+}
@@ -118,6 +118,10 @@ class Ext
     int context_depth = 5;
     int cc_model = 10;
     bool lef_res = false;
+    bool tiled = false;
+    int tile_size = 1000;
+    bool incremental = false;
+    int threads = 1;
   };
 
   void extract(ExtractOptions options);
@@ -140,7 +144,8 @@ class Ext
     const char* ext_corner_name = nullptr;
     const int corner = -1;
     const int debug = 0;
-    const bool parallel = false;
+    bool parallel = false;
+    int threads = 1;
     const bool init = false;
     const bool end = false;
     const bool use_ids = false;
@@ -149,7 +154,8 @@ class Ext
     const bool term_junction_xy = false;
     const bool single_pi = false;
     const char* file = nullptr;
-    const bool gz = false;
+    bool gz = false;
+    bool zstd = false;
     const bool stop_after_map = false;
     const bool w_clock = false;
     const bool w_conn = false;
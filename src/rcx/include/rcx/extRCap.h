@@ -33,6 +33,7 @@
 #pragma once
 
 #include <map>
+#include <vector>
 
 #include "ext2dBox.h"
 #include "extprocess.h"
@@ -863,8 +864,8 @@ class extMeasure
                    uint trackn,
                    Ath__array1D<SEQ*>* residueSeq);
 
-  odb::dbCCSeg* makeCcap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, double ccCap);
-  void addCCcap(odb::dbCCSeg* ccap, double v, uint model);
+  bool makeCcap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, double ccCap);
+  void addCCcap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, double v, uint model);
   void addFringe(odb::dbRSeg* rseg1,
                  odb::dbRSeg* rseg2,
                  double frCap,
@@ -1230,6 +1231,36 @@ class extCorner
   extCorner* _extCornerPtr;
 };
 
+// Resistance and capacitance additions of one tiled coupling window.
+// Windows are extracted concurrently; their updates are applied to the
+// block one window at a time, in the order they were recorded.
+class extRCUpdates
+{
+ public:
+  void addRes(odb::dbRSeg* rseg, double res, int dbIndex);
+  void addCap(odb::dbRSeg* rseg, double cap, int dbIndex);
+  void addCC(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, double cap, int dbIndex);
+  void apply(odb::dbBlock* block) const;
+  uint getCnt() const { return _updates.size(); }
+
+ private:
+  enum UpdateType
+  {
+    RES,
+    CAP,
+    CC
+  };
+  struct Update
+  {
+    UpdateType type;
+    odb::dbRSeg* rseg1;
+    odb::dbRSeg* rseg2;
+    double value;
+    int dbIndex;
+  };
+  std::vector<Update> _updates;
+};
+
 class extMain
 {
  public:
@@ -1259,6 +1290,13 @@ class extMain
       _debug_net_id = atoi(nets);
     }
   }
+  void setTiledCoupling(bool tiled, int threadCnt, uint tileTracks)
+  {
+    _tiledCoupling = tiled;
+    _threadCnt = threadCnt;
+    _tileTracks = tileTracks;
+  }
+  void setIncremental(bool incremental) { _incremental = incremental; }
 
   static void createShapeProperty(odb::dbNet* net, int id, int id_val);
   static int getShapeProperty(odb::dbNet* net, int id);
@@ -1350,6 +1388,18 @@ class extMain
                     uint ccFlag,
                     extMeasure* m,
                     CoupleAndCompute coupleAndCompute);
+  uint couplingFlowTiled(odb::Rect& extRect, uint ccFlag);
+  uint couplingWindow(uint dir,
+                      int loXY,
+                      int hiXY,
+                      int loLoad,
+                      int hiLoad,
+                      odb::Rect& extRect,
+                      uint ccFlag,
+                      extMeasure* m);
+  void initTiledWindow(extMain* parent, uint dir);
+  void removeTiledWindow();
+  void initCouplingMeasure(extMeasure* m);
   uint initPlanes(uint dir,
                   int* wLL,
                   int* wUR,
@@ -1416,9 +1466,15 @@ class extMain
   double getFringe(uint met, uint width, uint modelIndex, double& areaCap);
   void printNet(odb::dbNet* net, uint netId);
   double calcFringe(extDistRC* rc, double deltaFr, bool includeCoupling);
-  double updateTotalCap(odb::dbRSeg* rseg, double cap, uint modelIndex);
+  void updateTotalCap(odb::dbRSeg* rseg, double cap, uint modelIndex);
   bool updateCoupCap(odb::dbRSeg* rseg1, odb::dbRSeg* rseg2, int jj, double v);
-  double updateRes(odb::dbRSeg* rseg, double res, uint model);
+  void updateRes(odb::dbRSeg* rseg, double res, uint model);
+  void addRsegCap(odb::dbRSeg* rseg, double cap, int dbIndex);
+  void addRsegRes(odb::dbRSeg* rseg, double res, int dbIndex);
+  void addCouplingCap(odb::dbRSeg* rseg1,
+                      odb::dbRSeg* rseg2,
+                      double cap,
+                      int dbIndex);
 
   uint getExtBbox(int* x1, int* y1, int* x2, int* y2);
 
@@ -1451,6 +1507,7 @@ class extMain
   void unlinkRSeg(std::vector<odb::dbNet*>& nets);
   void unlinkCapNode(std::vector<odb::dbNet*>& nets);
   void removeExt(std::vector<odb::dbNet*>& nets);
+  void getIncrementalNets(std::vector<odb::dbNet*>& nets);
   void removeRSeg(std::vector<odb::dbNet*>& nets);
   void removeCapNode(std::vector<odb::dbNet*>& nets);
   void adjustRC(double resFactor, double ccFactor, double gndcFactor);
@@ -1554,6 +1611,7 @@ class extMain
                  const char* capUnit,
                  const char* resUnit,
                  bool gzFlag,
+                 bool zstdFlag,
                  bool stopAfterMap,
                  bool wClock,
                  bool wConn,
@@ -1567,7 +1625,8 @@ class extMain
                  int corner,
                  const char* corner_name,
                  const char* spef_version,
-                 bool parallel);
+                 bool parallel,
+                 int threadCnt);
   uint writeNetSPEF(odb::dbNet* net, double resBound, uint debug);
   uint makeITermCapNode(uint id, odb::dbNet* net);
   uint makeBTermCapNode(uint id, odb::dbNet* net);
@@ -2213,6 +2272,14 @@ class extMain
   uint _debug_net_id = 0;
   float _previous_percent_extracted = 0;
 
+  bool _tiledCoupling = false;
+  int _threadCnt = 1;
+  uint _tileTracks = 1000;  // window size of the tiled flow, in tracks
+  extRCUpdates* _rcUpdates = nullptr;  // set while extracting a tiled window
+  // Only the marked nets are re-extracted; the parasitics of other nets are
+  // left as they are.
+  bool _incremental = false;
+
   double _minCapTable[64][64];
   double _maxCapTable[64][64];
   double _minResTable[64][64];
@@ -75,6 +75,8 @@ class extSpef
   int getWriteCorner(int corner, const char* name);
   void setUseIdsFlag(bool diff = false, bool calib = false);
   void setGzipFlag(bool gzFlag);
+  void setZstdFlag(bool zstdFlag);
+  void setThreadCnt(int threadCnt) { _threadCnt = threadCnt; }
   void setDesign(const char* name);
   void writeBlock(const char* nodeCoord,
                   const char* capUnit,
@@ -138,6 +140,8 @@ class extSpef
   bool computeFactor(double db, double ref, float& factor);
 
   void initNodeCoordTables(uint memChunk);
+  void initNetWriter(const extSpef* parent);
+  uint writeNetsParallel(const std::vector<odb::dbNet*>& nets);
   void resetNodeCoordTables();
   void deleteNodeCoordTables();
   bool readNodeCoords(uint cpos);
@@ -337,7 +341,7 @@ class extSpef
     C_ON
   };
 
-  char _inFile[1024];
+  char _inFile[1024] = "";
   FILE* _inFP;
 
   char _outFile[1024];
@@ -444,6 +448,8 @@ class extSpef
   uint _minNetNode;
 
   bool _gzipFlag = false;
+  bool _zstdFlag = false;
+  int _threadCnt = 1;
   bool _stopAfterNameMap = false;
   float _upperCalibLimit;
   float _lowerCalibLimit;
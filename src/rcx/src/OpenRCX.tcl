@@ -62,6 +62,9 @@ sta::define_cmd_args "extract_parasitics" {
     [-cc_model track]
     [-context_depth depth]
     [-no_merge_via_res]
+    [-tiled]
+    [-tile_size tracks]
+    [-incremental]
 }
 
 proc extract_parasitics { args } {
@@ -72,9 +75,12 @@ proc extract_parasitics { args } {
            -coupling_threshold
            -debug_net_id
            -context_depth
-           -cc_model } \
+           -cc_model
+           -tile_size } \
     flags { -lef_res
-            -no_merge_via_res }
+            -no_merge_via_res
+            -tiled
+            -incremental }
 
   set ext_model_file ""
   if { [info exists keys(-ext_model_file)] } {
@@ -101,6 +107,8 @@ proc extract_parasitics { args } {
 
   set lef_res [info exists flags(-lef_res)]
   set no_merge_via_res [info exists flags(-no_merge_via_res)]
+  set tiled [info exists flags(-tiled)]
+  set incremental [info exists flags(-incremental)]
 
   set cc_model 10
   if { [info exists keys(-cc_model)] } {
@@ -113,6 +121,12 @@ proc extract_parasitics { args } {
     sta::check_positive_integer "-context_depth" $depth
   }
 
+  set tile_size 1000
+  if { [info exists keys(-tile_size)] } {
+    set tile_size $keys(-tile_size)
+    sta::check_positive_integer "-tile_size" $tile_size
+  }
+
   set debug_net_id ""
   if { [info exists keys(-debug_net_id)] } {
     set debug_net_id $keys(-debug_net_id)
@@ -120,19 +134,21 @@ proc extract_parasitics { args } {
 
   rcx::extract $ext_model_file $corner_cnt $max_res \
     $coupling_threshold $cc_model \
-    $depth $debug_net_id $lef_res $no_merge_via_res
+    $depth $debug_net_id $lef_res $no_merge_via_res $tiled \
+    $tile_size $incremental
 }
 
 sta::define_cmd_args "write_spef" {
   [-net_id net_id]
   [-nets nets]
   [-coordinates]
+  [-gzip|-zstd]
   filename }
 
 proc write_spef { args } {
   sta::parse_key_args "write_spef" args \
     keys { -net_id -nets } \
-    flags { -coordinates }
+    flags { -coordinates -gzip -zstd }
   sta::check_argc_eq1 "write_spef" $args
 
   set spef_file $args
@@ -148,8 +164,13 @@ proc write_spef { args } {
   }
 
   set coordinates [info exists flags(-coordinates)]
+  set gzip [info exists flags(-gzip)]
+  set zstd [info exists flags(-zstd)]
+  if { $gzip && $zstd } {
+    utl::error RCX 12 "-gzip and -zstd are mutually exclusive."
+  }
 
-  rcx::write_spef $spef_file $nets $net_id $coordinates
+  rcx::write_spef $spef_file $nets $net_id $coordinates $gzip $zstd
 }
 
 sta::define_cmd_args "adjust_rc" {
@@ -241,6 +241,8 @@ void Ext::extract(ExtractOptions options)
 
   _ext->set_debug_nets(options.debug_net);
   _ext->_lef_res = options.lef_res;
+  _ext->setTiledCoupling(options.tiled, options.threads, options.tile_size);
+  _ext->setIncremental(options.incremental);
 
   _ext->makeBlockRCsegs(options.net,
                         options.cc_up,
@@ -299,6 +301,7 @@ void Ext::write_spef(const SpefOptions& options)
                   options.cap_units,
                   options.res_units,
                   options.gz,
+                  options.zstd,
                   options.stop_after_map,
                   options.w_clock,
                   options.w_conn,
@@ -312,7 +315,8 @@ void Ext::write_spef(const SpefOptions& options)
                   options.corner,
                   name,
                   spef_version_,
-                  options.parallel);
+                  options.parallel,
+                  options.threads);
 
   logger_->info(RCX, 17, "Finished writing SPEF ...");
 }
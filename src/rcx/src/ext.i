@@ -70,7 +70,10 @@ extract(const char* ext_model_file,
         int context_depth,
         const char* debug_net_id,
         bool lef_res,
-        bool no_merge_via_res)
+        bool no_merge_via_res,
+        bool tiled,
+        int tile_size,
+        bool incremental)
 {
   Ext* ext = getOpenRCX();
   Ext::ExtractOptions opts;
@@ -84,7 +87,11 @@ extract(const char* ext_model_file,
   opts.lef_res = lef_res;
   opts.debug_net = debug_net_id;
   opts.no_merge_via_res = no_merge_via_res;
-  
+  opts.tiled = tiled;
+  opts.tile_size = tile_size;
+  opts.incremental = incremental;
+  opts.threads = ord::getOpenRoad()->getThreadCount();
+
   ext->extract(opts);
 }
 
@@ -92,7 +99,9 @@ void
 write_spef(const char* file,
            const char* nets,
            int net_id,
-           bool write_coordinates)
+           bool write_coordinates,
+           bool gzip,
+           bool zstd)
 {
   Ext* ext = getOpenRCX();
   Ext::SpefOptions opts;
@@ -102,6 +111,10 @@ write_spef(const char* file,
   if (write_coordinates) {
     opts.N = "Y";
   }
+  opts.gz = gzip;
+  opts.zstd = zstd;
+  opts.threads = ord::getOpenRoad()->getThreadCount();
+  opts.parallel = opts.threads > 1;
   
   ext->write_spef(opts);
 }
@@ -41,7 +41,7 @@ CoupleOptions coupleOptionsNull{};
 
 namespace rcx {
 
-static uint ttttGetDgOverlap;
+static thread_local uint ttttGetDgOverlap;
 
 uint Ath__track::trackContextOn(int orig,
                                 int end,
@@ -694,14 +694,22 @@ void Ath__track::buildDgContext(Ath__array1D<SEQ*>* dgContext,
 
 void Ath__grid::buildDgContext(int gridn, int base)
 {
-  static Ath__wire** allCtxwire = nullptr;
-  static int awcnt;
-  static int awsize;
-  if (allCtxwire == nullptr) {
-    allCtxwire = (Ath__wire**) calloc(sizeof(Ath__wire*), 4096);
-    awsize = 4096;
+  // Per thread: tiled coupling extraction builds contexts concurrently.
+  // The array is freed when its thread exits.
+  struct CtxWires
+  {
+    Ath__wire** wires = nullptr;
+    int size = 0;
+    ~CtxWires() { free(wires); }
+  };
+  thread_local CtxWires ctxWires;
+  if (ctxWires.wires == nullptr) {
+    ctxWires.wires = (Ath__wire**) calloc(sizeof(Ath__wire*), 4096);
+    ctxWires.size = 4096;
   }
-  awcnt = 0;
+  Ath__wire**& allCtxwire = ctxWires.wires;
+  int& awsize = ctxWires.size;
+  int awcnt = 0;
   uint btrackN = getMinMaxTrackNum(base);
   uint dgContextTrackRange = _gridtable->getCcFlag();
   int lowtrack
@@ -812,6 +820,59 @@ uint Ath__gridTable::couplingCaps(uint row,
   return 0;
 }
 
+uint Ath__grid::trackCouplingCaps(uint trackNum,
+                                  uint couplingDist,
+                                  rcx::CoupleAndCompute coupleAndCompute,
+                                  void* compPtr)
+{
+  Ath__track* btrack = _trackTable[trackNum];
+  if (btrack == nullptr) {
+    return 0;
+  }
+
+  uint coupleTrackNum = couplingDist;  // EXT-OPTIMIZE
+  uint ccThreshold = coupleTrackNum * _pitch;
+  uint TargetHighMarkedNet = _gridtable->targetHighMarkedNet();
+  bool allNet = _gridtable->allNet();
+
+  int base = btrack->getBase();
+  _gridtable->buildDgContext(base, _level, _dir);
+  if (!ttttGetDgOverlap) {
+    coupleAndCompute(rcx::coupleOptionsNull, compPtr);  // try print dgContext
+  }
+
+  uint wireCnt = 0;
+  Ath__track* track = nullptr;
+  bool tohi = true;
+  while ((track = btrack->getNextSubTrack(track, tohi))) {
+    _gridtable->setHandleEmptyOnly(false);
+    uint cnt1 = track->couplingCaps(nullptr,
+                                    trackNum,
+                                    coupleTrackNum,
+                                    ccThreshold,
+                                    nullptr,
+                                    _level,
+                                    coupleAndCompute,
+                                    compPtr);
+    wireCnt += cnt1;
+    if (allNet || TargetHighMarkedNet) {
+      _gridtable->setHandleEmptyOnly(true);
+    }
+    _gridtable->reverseTargetTrack();
+    cnt1 = track->couplingCaps(nullptr,
+                               trackNum,
+                               coupleTrackNum,
+                               ccThreshold,
+                               nullptr,
+                               _level,
+                               coupleAndCompute,
+                               compPtr);
+    wireCnt += cnt1;
+    _gridtable->reverseTargetTrack();
+  }
+  return wireCnt;
+}
+
 int Ath__grid::couplingCaps(int hiXY,
                             uint couplingDist,
                             uint& wireCnt,
@@ -850,51 +911,43 @@ int Ath__grid::couplingCaps(int hiXY,
       return baseXY;
     }
 
-    Ath__track* btrack = _trackTable[ii];
-    if (btrack == nullptr) {
-      continue;
-    }
-
-    int base = btrack->getBase();
-    _gridtable->buildDgContext(base, _level, _dir);
-    if (!ttttGetDgOverlap) {
-      coupleAndCompute(rcx::coupleOptionsNull, compPtr);  // try print dgContext
-    }
-
-    Ath__track* track = nullptr;
-    bool tohi = true;
-    while ((track = btrack->getNextSubTrack(track, tohi))) {
-      _gridtable->setHandleEmptyOnly(false);
-      uint cnt1 = track->couplingCaps(nullptr,
-                                      ii,
-                                      coupleTrackNum,
-                                      ccThreshold,
-                                      nullptr,
-                                      _level,
-                                      coupleAndCompute,
-                                      compPtr);
-      wireCnt += cnt1;
-      if (allNet || TargetHighMarkedNet) {
-        _gridtable->setHandleEmptyOnly(true);
-      }
-      _gridtable->reverseTargetTrack();
-      cnt1 = track->couplingCaps(nullptr,
-                                 ii,
-                                 coupleTrackNum,
-                                 ccThreshold,
-                                 nullptr,
-                                 _level,
-                                 coupleAndCompute,
-                                 compPtr);
-      wireCnt += cnt1;
-      _gridtable->reverseTargetTrack();
-    }
+    wireCnt += trackCouplingCaps(ii, couplingDist, coupleAndCompute, compPtr);
   }
   limitArray[4] = _searchHiTrack;
   limitArray[5] = hiXY;
   return hiXY;
 }
 
+// Extracts the tracks whose base is in [loXY, hiXY). The grid has to hold
+// the wires of couplingDist tracks on either side of the window.
+uint Ath__grid::couplingCapsInWindow(int loXY,
+                                     int hiXY,
+                                     uint couplingDist,
+                                     rcx::CoupleAndCompute coupleAndCompute,
+                                     void* compPtr)
+{
+  uint TargetHighMarkedNet = _gridtable->targetHighMarkedNet();
+  bool allNet = _gridtable->allNet();
+
+  uint domainAdjust = allNet || !TargetHighMarkedNet ? 0 : couplingDist;
+
+  initContextGrids();
+  setSearchDomain(domainAdjust);
+
+  uint wireCnt = 0;
+  for (uint ii = _searchLowTrack; ii <= _searchHiTrack; ii++) {
+    int baseXY = _base + _pitch * ii;
+    if (baseXY < loXY) {
+      continue;
+    }
+    if (baseXY >= hiXY) {
+      break;
+    }
+    wireCnt += trackCouplingCaps(ii, couplingDist, coupleAndCompute, compPtr);
+  }
+  return wireCnt;
+}
+
 int Ath__grid::dealloc(int hiXY)
 {
   for (uint ii = _lastFreeTrack; ii <= _searchHiTrack; ii++) {
@@ -1091,6 +1144,29 @@ int Ath__grid::initCouplingCapLoops(uint couplingDist,
   return _base + _pitch * _searchHiTrack;
 }
 
+uint Ath__gridTable::couplingCapsInWindow(
+    uint dir,
+    int loXY,
+    int hiXY,
+    uint couplingDist,
+    rcx::CoupleAndCompute coupleAndCompute,
+    void* compPtr)
+{
+  ttttGetDgOverlap = 1;
+  setCCFlag(couplingDist);
+
+  uint wireCnt = 0;
+  for (uint jj = 1; jj < _colCnt; jj++) {
+    Ath__grid* netGrid = _gridTable[dir][jj];
+    if (netGrid == nullptr) {
+      continue;
+    }
+    wireCnt += netGrid->couplingCapsInWindow(
+        loXY, hiXY, couplingDist, coupleAndCompute, compPtr);
+  }
+  return wireCnt;
+}
+
 void Ath__gridTable::initCouplingCapLoops(
     uint dir,
     uint couplingDist,
@@ -30,12 +30,15 @@
 // ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
 // POSSIBILITY OF SUCH DAMAGE.
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <vector>
 
 #include "rcx/dbUtil.h"
 #include "rcx/extRCap.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 #include "wire.h"
 
 namespace rcx {
@@ -1206,7 +1209,7 @@ uint extMain::couplingFlow(Rect& extRect,
                          _CCnoPowerSource,
                          _CCnoPowerTarget,
                          _ccUp,
-                         _allNet,
+                         _allNet || _incremental,
                          _ccContextDepth,
                          _ccContextArray,
                          _dgContextArray,
@@ -1374,6 +1377,346 @@ uint extMain::couplingFlow(Rect& extRect,
   return 0;
 }
 
+void extCompute1(CoupleOptions& inputTable, void* extModel);
+
+// Copies the extraction settings of parent into a window of its coupling
+// flow. The window owns its search grid, planes and context arrays.
+void extMain::initTiledWindow(extMain* parent, uint dir)
+{
+  logger_ = parent->logger_;
+  _db = parent->_db;
+  _tech = parent->_tech;
+  _block = parent->_block;
+
+  _currentModel = parent->_currentModel;
+  for (uint ii = 0; ii < parent->_modelMap.getCnt(); ii++) {
+    _modelMap.add(parent->_modelMap.get(ii));
+  }
+  for (uint ii = 0; ii < parent->_metRCTable.getCnt(); ii++) {
+    _metRCTable.add(parent->_metRCTable.get(ii));
+  }
+  _processCornerTable = parent->_processCornerTable;
+  _scaledCornerTable = parent->_scaledCornerTable;
+  _batchScaleExt = parent->_batchScaleExt;
+  _minModelIndex = parent->_minModelIndex;
+  _typModelIndex = parent->_typModelIndex;
+  _maxModelIndex = parent->_maxModelIndex;
+  std::copy(&parent->_minDistTable[0],
+            &parent->_minDistTable[0] + 20,
+            &_minDistTable[0]);
+  std::copy(&parent->_resistanceTable[0][0],
+            &parent->_resistanceTable[0][0] + 20 * 20,
+            &_resistanceTable[0][0]);
+
+  _resFactor = parent->_resFactor;
+  _resModify = parent->_resModify;
+  _ccFactor = parent->_ccFactor;
+  _ccModify = parent->_ccModify;
+  _gndcFactor = parent->_gndcFactor;
+  _gndcModify = parent->_gndcModify;
+  _coupleThreshold = parent->_coupleThreshold;
+  _lef_res = parent->_lef_res;
+
+  _diagFlow = parent->_diagFlow;
+  _usingMetalPlanes = parent->_usingMetalPlanes;
+  _allNet = parent->_allNet;
+  _incremental = parent->_incremental;
+  _ccUp = parent->_ccUp;
+  _couplingFlag = parent->_couplingFlag;
+  _ccContextDepth = parent->_ccContextDepth;
+  _CCnoPowerSource = parent->_CCnoPowerSource;
+  _CCnoPowerTarget = parent->_CCnoPowerTarget;
+  _debug_net_id = parent->_debug_net_id;
+
+  _rotatedGs = dir == 0;
+
+  if (_ccContextDepth) {
+    initContextArray();
+  }
+  initDgContextArray();
+}
+
+void extMain::removeTiledWindow()
+{
+  removeDgContextArray();
+  if (_ccContextArray) {
+    const uint layerCnt = getExtLayerCnt(_tech);
+    for (uint ii = 1; ii <= layerCnt; ii++) {
+      delete _ccContextArray[ii];
+      delete _ccMergedContextArray[ii];
+    }
+    delete[] _ccContextArray;
+    delete[] _ccMergedContextArray;
+    _ccContextArray = nullptr;
+    _ccMergedContextArray = nullptr;
+  }
+  delete _geomSeq;
+  _geomSeq = nullptr;
+  delete _search;
+  _search = nullptr;
+  delete _modelTable;
+  _modelTable = nullptr;
+}
+
+// Extracts the coupling of the wires of direction dir on the tracks whose
+// base is in [loXY, hiXY). Wires with their low edge in [loLoad, hiLoad)
+// are loaded, so that the halo around the window has the neighbors and
+// the context of its tracks.
+uint extMain::couplingWindow(uint dir,
+                             int loXY,
+                             int hiXY,
+                             int loLoad,
+                             int hiLoad,
+                             Rect& extRect,
+                             uint ccFlag,
+                             extMeasure* m)
+{
+  uint sigtype = 9;
+  uint pwrtype = 11;
+
+  uint pitchTable[32];
+  uint widthTable[32];
+  for (uint ii = 0; ii < 32; ii++) {
+    pitchTable[ii] = 0;
+    widthTable[ii] = 0;
+  }
+  uint dirTable[16];
+  int baseX[32];
+  int baseY[32];
+  uint layerCnt = initSearchForNets(
+      baseX, baseY, pitchTable, widthTable, dirTable, extRect, false);
+
+  layerCnt = (int) layerCnt > _currentModel->getLayerCnt()
+                 ? layerCnt
+                 : _currentModel->getLayerCnt();
+  int ll[2];
+  int ur[2];
+  ll[0] = extRect.xMin();
+  ll[1] = extRect.yMin();
+  ur[0] = extRect.xMax();
+  ur[1] = extRect.yMax();
+
+  Ath__overlapAdjust overlapAdj = Z_noAdjust;
+  _useDbSdb = true;
+  _search->setExtControl(_block,
+                         _useDbSdb,
+                         (uint) overlapAdj,
+                         _CCnoPowerSource,
+                         _CCnoPowerTarget,
+                         _ccUp,
+                         _allNet || _incremental,
+                         _ccContextDepth,
+                         _ccContextArray,
+                         _dgContextArray,
+                         &_dgContextDepth,
+                         &_dgContextPlanes,
+                         &_dgContextTracks,
+                         &_dgContextBaseLvl,
+                         &_dgContextLowLvl,
+                         &_dgContextHiLvl,
+                         _dgContextBaseTrack,
+                         _dgContextLowTrack,
+                         _dgContextHiTrack,
+                         _dgContextTrackBase,
+                         m->_seqPool);
+
+  _seqPool = m->_seqPool;
+
+  int lo_gs[2];
+  int hi_gs[2];
+  int lo_sdb[2];
+  int hi_sdb[2];
+  lo_gs[!dir] = ll[!dir];
+  hi_gs[!dir] = ur[!dir];
+  lo_sdb[!dir] = ll[!dir];
+  hi_sdb[!dir] = ur[!dir];
+
+  // the planes are aligned to the low edge of the die
+  lo_gs[dir] = std::max(loLoad, ll[dir]);
+  hi_gs[dir] = hiLoad;
+  lo_sdb[dir] = loLoad;
+  hi_sdb[dir] = hiLoad;
+
+  fill_gs4(
+      dir, ll, ur, lo_gs, hi_gs, layerCnt, dirTable, pitchTable, widthTable);
+
+  m->_rotatedGs = getRotatedFlag();
+  m->_pixelTable = _geomSeq;
+
+  addPowerNets(dir, lo_sdb, hi_sdb, pwrtype);
+  addSignalNets(dir, lo_sdb, hi_sdb, sigtype);
+
+  return _search->couplingCapsInWindow(
+      dir, loXY, hiXY, ccFlag, extCompute1, m);
+}
+
+// Tiled version of couplingFlow: the strips of each direction become
+// windows that are extracted concurrently, each on its own search grid,
+// planes and extMeasure. A window owns the tracks whose base is in it, so
+// a coupling cap in the halo of two windows is extracted only by the
+// window of its source track. The updates of a window are buffered and
+// applied to the block in window order, which makes the result
+// independent of the thread count.
+uint extMain::couplingFlowTiled(Rect& extRect, uint ccFlag)
+{
+  uint ccDist = ccFlag;
+
+  uint pitchTable[32];
+  uint widthTable[32];
+  for (uint ii = 0; ii < 32; ii++) {
+    pitchTable[ii] = 0;
+    widthTable[ii] = 0;
+  }
+  uint dirTable[16];
+  int baseX[32];
+  int baseY[32];
+  uint layerCnt = initSearchForNets(
+      baseX, baseY, pitchTable, widthTable, dirTable, extRect, false);
+  // only the layer tables are needed; every window has its own grid
+  delete _search;
+  _search = nullptr;
+
+  const int maxPitch = pitchTable[layerCnt - 1];
+
+  int ll[2];
+  int ur[2];
+  ll[0] = extRect.xMin();
+  ll[1] = extRect.yMin();
+  ur[0] = extRect.xMax();
+  ur[1] = extRect.yMax();
+
+  uint maxWidth = 0;
+  uint totPowerWireCnt = powerWireCounter(maxWidth);
+  uint totWireCnt = signalWireCounter(maxWidth);
+  totWireCnt += totPowerWireCnt;
+
+  logger_->info(RCX, 43, "{} wires to be extracted", totWireCnt);
+
+  // By default the same steps as the strips of couplingFlow.
+  const uint trackStep = _tileTracks;
+  const int halo = 2 * (ccDist + 1) * maxPitch;
+
+  struct Window
+  {
+    uint dir;
+    int loXY;
+    int hiXY;
+    int loLoad;
+    int hiLoad;
+  };
+  std::vector<Window> windows;
+  for (int dir = 1; dir >= 0; dir--) {
+    int step = trackStep * pitchTable[1];
+    if (maxWidth > ccDist * maxPitch) {
+      step = ur[dir] - ll[dir];
+    }
+    step = std::max(step, 1);
+
+    const int loLimit = ll[dir] - step;
+    const int hiLimit = ur[dir] + 5 * ccDist * maxPitch;
+    int loXY = -MAX_INT;
+    for (int hiXY = ll[dir] + step;; hiXY += step) {
+      const bool last = ur[dir] - hiXY <= 0;
+      Window window;
+      window.dir = dir;
+      window.loXY = loXY;
+      window.hiXY = last ? MAX_INT : hiXY;
+      window.loLoad = loXY == -MAX_INT ? loLimit : loXY - halo;
+      window.hiLoad = last ? hiLimit : std::min(hiLimit, hiXY + halo);
+      windows.push_back(window);
+      if (last) {
+        break;
+      }
+      loXY = hiXY;
+    }
+  }
+
+  if (_incremental) {
+    // A window away from the re-extracted nets would only update unchanged
+    // nets.
+    std::vector<Rect> boxes;
+    for (dbNet* net : _block->getNets()) {
+      if (!net->isMarked() || net->getWire() == nullptr) {
+        continue;
+      }
+      if (auto box = net->getWire()->getBBox()) {
+        boxes.push_back(*box);
+      }
+    }
+    auto isAffected = [&boxes, halo](const Window& w) {
+      for (const Rect& box : boxes) {
+        const int lo = w.dir == 0 ? box.xMin() : box.yMin();
+        const int hi = w.dir == 0 ? box.xMax() : box.yMax();
+        if ((w.loXY == -MAX_INT || hi >= w.loXY - halo)
+            && (w.hiXY == MAX_INT || lo < w.hiXY + halo)) {
+          return true;
+        }
+      }
+      return false;
+    };
+    windows.erase(
+        std::remove_if(windows.begin(),
+                       windows.end(),
+                       [&](const Window& w) { return !isAffected(w); }),
+        windows.end());
+  }
+
+  logger_->info(RCX,
+                6,
+                "Coupling extraction of {} windows on {} thread(s).",
+                windows.size(),
+                _threadCnt);
+
+  // The block is only read while windows are extracted; a batch of windows
+  // is written to it once all of them are done.
+  const int batchSize = 4 * std::max(_threadCnt, 1);
+  const int windowCnt = windows.size();
+  for (int first = 0; first < windowCnt; first += batchSize) {
+    const int end = std::min(first + batchSize, windowCnt);
+    std::vector<extRCUpdates> updates(end - first);
+
+    utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic) num_threads(_threadCnt)
+    for (int ii = first; ii < end; ii++) {
+      try {
+        const Window& w = windows[ii];
+
+        auto window = std::make_unique<extMain>();
+        window->initTiledWindow(this, w.dir);
+        window->_rcUpdates = &updates[ii - first];
+
+        extMeasure wm(logger_);
+        window->initCouplingMeasure(&wm);
+        wm._debugFP = nullptr;
+        wm._netId = 0;
+        window->couplingWindow(
+            w.dir, w.loXY, w.hiXY, w.loLoad, w.hiLoad, extRect, ccFlag, &wm);
+
+        window->removeTiledWindow();
+      } catch (...) {
+        exception.capture();
+      }
+    }
+    exception.rethrow();
+
+    for (const extRCUpdates& u : updates) {
+      u.apply(_block);
+    }
+
+    float percent_extracted = lround(100.0 * end / windowCnt);
+    if (percent_extracted - _previous_percent_extracted >= 5.0) {
+      logger_->info(RCX,
+                    9,
+                    "{:d}% completion -- {:d} windows have been extracted",
+                    (int) percent_extracted,
+                    end);
+      _previous_percent_extracted = percent_extracted;
+    }
+  }
+
+  return 0;
+}
+
 dbRSeg* extMain::getRseg(dbNet* net, uint shapeId, Logger* logger)
 {
   int rsegId2 = 0;
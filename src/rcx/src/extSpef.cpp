@@ -32,13 +32,19 @@
 
 #include "rcx/extSpef.h"
 
+#include <omp.h>
+
 #include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
 
 #include "name.h"
 #include "odb/dbExtControl.h"
 #include "odb/parse.h"
 #include "rcx/extRCap.h"
 #include "utl/Logger.h"
+#include "utl/exception.h"
 
 namespace rcx {
 
@@ -216,6 +222,11 @@ void extSpef::setGzipFlag(const bool gzFlag)
   _gzipFlag = gzFlag;
 }
 
+void extSpef::setZstdFlag(const bool zstdFlag)
+{
+  _zstdFlag = zstdFlag;
+}
+
 void extSpef::resetTermTables()
 {
   _btermTable->resetCnt(1);
@@ -1240,9 +1251,13 @@ bool extSpef::setOutSpef(const char* filename)
   strcpy(_outFile, filename);
 
   if (_gzipFlag) {
-    char cmd[2048];
-    sprintf(cmd, "gzip -1 > %s.gz", filename);
-    _outFP = popen(cmd, "w");
+    const std::string file = std::string(filename) + ".gz";
+    const std::string cmd = "gzip -1 > " + odb::shellQuote(file.c_str());
+    _outFP = popen(cmd.c_str(), "w");
+  } else if (_zstdFlag) {
+    const std::string file = std::string(filename) + ".zst";
+    const std::string cmd = "zstd -q -f -o " + odb::shellQuote(file.c_str());
+    _outFP = popen(cmd.c_str(), "w");
   } else {
     _outFP = fopen(filename, "w");
   }
@@ -1260,7 +1275,7 @@ bool extSpef::closeOutFile()
     return false;
   }
 
-  if (_gzipFlag) {
+  if (_gzipFlag || _zstdFlag) {
     pclose(_outFP);
   } else {
     fclose(_outFP);
@@ -1561,8 +1576,7 @@ void extSpef::writeBlock(const char* nodeCoord,
   _cornersPerBlock = _cornerCnt;
   _cornerBlock = _block;
 
-  uint cnt = 0;
-
+  std::vector<odb::dbNet*> nets;
   for (odb::dbNet* net : _block->getNets()) {
     if (!tnets.empty() && !net->isMarked()) {
       if (!_incrPlusCcNets || net->getCcCount() == 0) {
@@ -1576,13 +1590,21 @@ void extSpef::writeBlock(const char* nodeCoord,
     if (_wOnlyClock && type != odb::dbSigType::CLOCK) {
       continue;
     }
+    nets.push_back(net);
+  }
 
-    writeNet(net, 0.0, 0);
-    ++cnt;
+  uint cnt = 0;
+  if (parallel && _threadCnt > 1) {
+    cnt = writeNetsParallel(nets);
+  } else {
+    for (odb::dbNet* net : nets) {
+      writeNet(net, 0.0, 0);
+      ++cnt;
 
-    constexpr uint repChunk = 100000;
-    if (cnt % repChunk == 0) {
-      logger_->info(RCX, 42, "{} nets finished", cnt);
+      constexpr uint repChunk = 100000;
+      if (cnt % repChunk == 0) {
+        logger_->info(RCX, 42, "{} nets finished", cnt);
+      }
     }
   }
   for (odb::dbNet* net : tnets) {
@@ -1593,6 +1615,109 @@ void extSpef::writeBlock(const char* nodeCoord,
   closeOutFile();
 }
 
+// Copies the settings that writeNet depends on from the writer of the file.
+void extSpef::initNetWriter(const extSpef* parent)
+{
+  _cornerBlock = parent->_cornerBlock;
+  _cornerCnt = parent->_cornerCnt;
+  _cornersPerBlock = parent->_cornersPerBlock;
+  _active_corner_cnt = parent->_active_corner_cnt;
+  std::copy(parent->_active_corner_number,
+            parent->_active_corner_number + 32,
+            _active_corner_number);
+  _db_ext_corner = parent->_db_ext_corner;
+
+  _wConn = parent->_wConn;
+  _wCap = parent->_wCap;
+  _wOnlyCCcap = parent->_wOnlyCCcap;
+  _wRes = parent->_wRes;
+  _noCnum = parent->_noCnum;
+  _noBackSlash = parent->_noBackSlash;
+  _foreign = parent->_foreign;
+  _writingNodeCoords = parent->_writingNodeCoords;
+  _termJxy = parent->_termJxy;
+  _singleP = parent->_singleP;
+  _preserveCapValues = parent->_preserveCapValues;
+  _symmetricCCcaps = parent->_symmetricCCcaps;
+
+  _writeNameMap = parent->_writeNameMap;
+  _baseNameMap = parent->_baseNameMap;
+  _childBlockNetBaseMap = parent->_childBlockNetBaseMap;
+  _childBlockInstBaseMap = parent->_childBlockInstBaseMap;
+  _cap_unit = parent->_cap_unit;
+  _res_unit = parent->_res_unit;
+  strcpy(_delimiter, parent->_delimiter);
+
+  _nodeCapTable = new Ath__array1D<double*>(16000);
+  initCapTable(_nodeCapTable);
+}
+
+// Formats chunks of nets on _threadCnt threads, each writer into a memory
+// stream, and writes the chunks to the file in net order. A net only
+// changes the sort indices of its own cap nodes, so the output is the same
+// as the serial one.
+uint extSpef::writeNetsParallel(const std::vector<odb::dbNet*>& nets)
+{
+  std::vector<std::unique_ptr<extSpef>> writers;
+  for (int ii = 0; ii < _threadCnt; ii++) {
+    auto writer
+        = std::make_unique<extSpef>(_tech, _block, logger_, _version, _ext);
+    writer->initNetWriter(this);
+    writers.push_back(std::move(writer));
+  }
+
+  const int netCnt = nets.size();
+  // Up to 1000 nets a chunk; fewer in a small design, so that every thread
+  // has chunks to format.
+  const int chunkSize = std::clamp(netCnt / (4 * _threadCnt), 1, 1000);
+  const int chunkCnt = (netCnt + chunkSize - 1) / chunkSize;
+  const int batchSize = 4 * _threadCnt;
+
+  constexpr uint repChunk = 100000;
+  uint cnt = 0;
+  for (int first = 0; first < chunkCnt; first += batchSize) {
+    const int end = std::min(first + batchSize, chunkCnt);
+    std::vector<char*> bufs(end - first, nullptr);
+    std::vector<size_t> sizes(end - first, 0);
+
+    utl::ThreadException exception;
+#pragma omp parallel for schedule(dynamic) num_threads(_threadCnt)
+    for (int ii = first; ii < end; ii++) {
+      extSpef* writer = writers[omp_get_thread_num()].get();
+      writer->_outFP = open_memstream(&bufs[ii - first], &sizes[ii - first]);
+      try {
+        const int last = std::min((ii + 1) * chunkSize, netCnt);
+        for (int jj = ii * chunkSize; jj < last; jj++) {
+          writer->writeNet(nets[jj], 0.0, 0);
+        }
+      } catch (...) {
+        exception.capture();
+      }
+      fclose(writer->_outFP);
+      writer->_outFP = nullptr;
+    }
+    if (exception.hasException()) {
+      for (char* buf : bufs) {
+        free(buf);
+      }
+      exception.rethrow();
+    }
+
+    for (int ii = first; ii < end; ii++) {
+      fwrite(bufs[ii - first], 1, sizes[ii - first], _outFP);
+      free(bufs[ii - first]);
+
+      const uint prevCnt = cnt;
+      cnt += std::min((ii + 1) * chunkSize, netCnt) - ii * chunkSize;
+      for (uint rep = (prevCnt / repChunk + 1) * repChunk; rep <= cnt;
+           rep += repChunk) {
+        logger_->info(RCX, 42, "{} nets finished", rep);
+      }
+    }
+  }
+  return cnt;
+}
+
 void extSpef::write_spef_nets(const bool flatten, const bool parallel)
 {
   _childBlockNetBaseMap = 0;
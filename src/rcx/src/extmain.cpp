@@ -444,10 +444,7 @@ void extMain::updateTotalCap(dbRSeg* rseg,
 {
   double cap = frCap + ccCap - deltaFr;
 
-  double tot = rseg->getCapacitance(modelIndex);
-  tot += cap;
-
-  rseg->setCapacitance(tot, modelIndex);
+  addRsegCap(rseg, cap, modelIndex);
 }
 
 void extMain::updateTotalRes(dbRSeg* rseg1,
@@ -465,16 +462,10 @@ void extMain::updateTotalRes(dbRSeg* rseg1,
     }
 
     if (rseg1 != nullptr) {
-      double tot = rseg1->getResistance(modelIndex);
-      tot += res;
-
-      rseg1->setResistance(tot, modelIndex);
+      addRsegRes(rseg1, res, modelIndex);
     }
     if (rseg2 != nullptr) {
-      double tot = rseg2->getResistance(modelIndex);
-      tot += res;
-
-      rseg2->setResistance(tot, modelIndex);
+      addRsegRes(rseg2, res, modelIndex);
     }
   }
 }
@@ -486,7 +477,7 @@ void extMain::updateTotalCap(dbRSeg* rseg,
                              bool includeCoupling,
                              bool includeDiag)
 {
-  double tot, cap;
+  double cap;
   int extDbIndex, sci, scDbIdx;
   for (uint modelIndex = 0; modelIndex < modelCnt; modelIndex++) {
     extDistRC* rc = m->_rc[modelIndex];
@@ -509,35 +500,107 @@ void extMain::updateTotalCap(dbRSeg* rseg,
     }
 
     extDbIndex = getProcessCornerDbIndex(modelIndex);
-    tot = rseg->getCapacitance(extDbIndex);
-    tot += cap;
+    addRsegCap(rseg, cap, extDbIndex);
 
-    rseg->setCapacitance(tot, extDbIndex);
     getScaledCornerDbIndex(modelIndex, sci, scDbIdx);
     if (sci == -1) {
       continue;
     }
     getScaledGndC(sci, cap);
-    tot = rseg->getCapacitance(scDbIdx);
-    tot += cap;
-    rseg->setCapacitance(tot, scDbIdx);
+    addRsegCap(rseg, cap, scDbIdx);
   }
 }
 
 void extMain::updateCCCap(dbRSeg* rseg1, dbRSeg* rseg2, double ccCap)
 {
+  addCouplingCap(rseg1, rseg2, ccCap, 0);
+}
+
+// In incremental mode the nets that are not re-extracted keep their
+// parasitics, so nothing is added to them.
+void extMain::addRsegCap(dbRSeg* rseg, double cap, int dbIndex)
+{
+  if (_incremental && !rseg->getNet()->isMarked()) {
+    return;
+  }
+  if (_rcUpdates != nullptr) {
+    _rcUpdates->addCap(rseg, cap, dbIndex);
+    return;
+  }
+  rseg->setCapacitance(rseg->getCapacitance(dbIndex) + cap, dbIndex);
+}
+
+void extMain::addRsegRes(dbRSeg* rseg, double res, int dbIndex)
+{
+  if (_incremental && !rseg->getNet()->isMarked()) {
+    return;
+  }
+  if (_rcUpdates != nullptr) {
+    _rcUpdates->addRes(rseg, res, dbIndex);
+    return;
+  }
+  rseg->setResistance(rseg->getResistance(dbIndex) + res, dbIndex);
+}
+
+void extMain::addCouplingCap(dbRSeg* rseg1,
+                             dbRSeg* rseg2,
+                             double cap,
+                             int dbIndex)
+{
+  // A coupling cap between two unchanged nets is still in the block.
+  if (_incremental && !rseg1->getNet()->isMarked()
+      && !rseg2->getNet()->isMarked()) {
+    return;
+  }
+  if (_rcUpdates != nullptr) {
+    _rcUpdates->addCC(rseg1, rseg2, cap, dbIndex);
+    return;
+  }
   dbCCSeg* ccap
       = dbCCSeg::create(dbCapNode::getCapNode(_block, rseg1->getTargetNode()),
                         dbCapNode::getCapNode(_block, rseg2->getTargetNode()),
                         true);
-  bool mergeParallel = true;
+  ccap->addCapacitance(cap, dbIndex);
+}
 
-  uint lcnt = 1;
-  for (uint ii = 0; ii < lcnt; ii++) {
-    if (mergeParallel) {
-      ccap->addCapacitance(ccCap, ii);
-    } else {
-      ccap->setCapacitance(ccCap, ii);
+void extRCUpdates::addRes(dbRSeg* rseg, double res, int dbIndex)
+{
+  _updates.push_back({RES, rseg, nullptr, res, dbIndex});
+}
+
+void extRCUpdates::addCap(dbRSeg* rseg, double cap, int dbIndex)
+{
+  _updates.push_back({CAP, rseg, nullptr, cap, dbIndex});
+}
+
+void extRCUpdates::addCC(dbRSeg* rseg1,
+                         dbRSeg* rseg2,
+                         double cap,
+                         int dbIndex)
+{
+  _updates.push_back({CC, rseg1, rseg2, cap, dbIndex});
+}
+
+void extRCUpdates::apply(dbBlock* block) const
+{
+  for (const Update& u : _updates) {
+    switch (u.type) {
+      case RES:
+        u.rseg1->setResistance(u.rseg1->getResistance(u.dbIndex) + u.value,
+                               u.dbIndex);
+        break;
+      case CAP:
+        u.rseg1->setCapacitance(u.rseg1->getCapacitance(u.dbIndex) + u.value,
+                                u.dbIndex);
+        break;
+      case CC: {
+        dbCCSeg* ccap = dbCCSeg::create(
+            dbCapNode::getCapNode(block, u.rseg1->getTargetNode()),
+            dbCapNode::getCapNode(block, u.rseg2->getTargetNode()),
+            true);
+        ccap->addCapacitance(u.value, u.dbIndex);
+        break;
+      }
     }
   }
 }
@@ -698,20 +761,15 @@ void extMain::measureRC(CoupleOptions& options)
       }
       _totBigCCcnt++;
 
-      dbCCSeg* ccap = dbCCSeg::create(
-          dbCapNode::getCapNode(_block, rseg1->getTargetNode()),
-          dbCapNode::getCapNode(_block, rseg2->getTargetNode()),
-          true);
-
       int extDbIndex, sci, scDbIdx;
       for (uint jj = 0; jj < m._metRCTable.getCnt(); jj++) {
         extDbIndex = getProcessCornerDbIndex(jj);
-        ccap->addCapacitance(m._rc[jj]->_coupling, extDbIndex);
+        addCouplingCap(rseg1, rseg2, m._rc[jj]->_coupling, extDbIndex);
         getScaledCornerDbIndex(jj, sci, scDbIdx);
         if (sci != -1) {
           double cap = m._rc[jj]->_coupling;
           getScaledGndC(sci, cap);
-          ccap->addCapacitance(cap, scDbIdx);
+          addCouplingCap(rseg1, rseg2, cap, scDbIdx);
         }
       }
       updateTotalCap(rseg1, &m, deltaFr, m._metRCTable.getCnt(), false);
@@ -1878,11 +1878,7 @@ void extMeasure::printNet(dbRSeg* rseg, uint netId)
 bool extMain::updateCoupCap(dbRSeg* rseg1, dbRSeg* rseg2, int jj, double v)
 {
   if (rseg1 != nullptr && rseg2 != nullptr) {
-    dbCCSeg* ccap
-        = dbCCSeg::create(dbCapNode::getCapNode(_block, rseg1->getTargetNode()),
-                          dbCapNode::getCapNode(_block, rseg2->getTargetNode()),
-                          true);
-    ccap->addCapacitance(v, jj);
+    addCouplingCap(rseg1, rseg2, v, jj);
     return true;
   }
   if (rseg1 != nullptr) {
@@ -1911,28 +1907,22 @@ double extMain::calcFringe(extDistRC* rc, double deltaFr, bool includeCoupling)
   return cap;
 }
 
-double extMain::updateTotalCap(dbRSeg* rseg, double cap, uint modelIndex)
+void extMain::updateTotalCap(dbRSeg* rseg, double cap, uint modelIndex)
 {
   if (rseg == nullptr) {
-    return 0;
+    return;
   }
 
   int extDbIndex, sci, scDbIndex;
   extDbIndex = getProcessCornerDbIndex(modelIndex);
-  double tot = rseg->getCapacitance(extDbIndex);
-  tot += cap;
+  addRsegCap(rseg, cap, extDbIndex);
 
-  rseg->setCapacitance(tot, extDbIndex);
-  // return rseg->getCapacitance(extDbIndex);
   getScaledCornerDbIndex(modelIndex, sci, scDbIndex);
   if (sci == -1) {
-    return tot;
+    return;
   }
   getScaledGndC(sci, cap);
-  double tots = rseg->getCapacitance(scDbIndex);
-  tots += cap;
-  rseg->setCapacitance(tots, scDbIndex);
-  return tot;
+  addRsegCap(rseg, cap, scDbIndex);
 }
 
 void extDistRC::addRC(extDistRC* rcUnit, uint len, bool addCC)
@@ -1948,21 +1938,17 @@ void extDistRC::addRC(extDistRC* rcUnit, uint len, bool addCC)
   }
 }
 
-double extMain::updateRes(dbRSeg* rseg, double res, uint model)
+void extMain::updateRes(dbRSeg* rseg, double res, uint model)
 {
   if (rseg == nullptr) {
-    return 0;
+    return;
   }
 
   if (_resModify) {
     res *= _resFactor;
   }
 
-  double tot = rseg->getResistance(model);
-  tot += res;
-
-  rseg->setResistance(tot, model);
-  return rseg->getResistance(model);
+  addRsegRes(rseg, res, model);
 }
 
 bool extMeasure::isConnectedToBterm(dbRSeg* rseg1)
@@ -1983,7 +1969,7 @@ bool extMeasure::isConnectedToBterm(dbRSeg* rseg1)
   return false;
 }
 
-dbCCSeg* extMeasure::makeCcap(dbRSeg* rseg1, dbRSeg* rseg2, double ccCap)
+bool extMeasure::makeCcap(dbRSeg* rseg1, dbRSeg* rseg2, double ccCap)
 {
   if ((rseg1 != nullptr) && (rseg2 != nullptr)
       && rseg1->getNet() != rseg2->getNet()) {  // signal nets
@@ -1992,22 +1978,18 @@ dbCCSeg* extMeasure::makeCcap(dbRSeg* rseg1, dbRSeg* rseg2, double ccCap)
 
     if (ccCap >= _extMain->_coupleThreshold) {
       _totBigCCcnt++;
-
-      dbCapNode* node1 = rseg1->getTargetCapNode();
-      dbCapNode* node2 = rseg2->getTargetCapNode();
-
-      return dbCCSeg::create(node1, node2, true);
+      return true;
     }
     _totSmallCCcnt++;
-    return nullptr;
+    return false;
   }
-  return nullptr;
+  return false;
 }
 
-void extMeasure::addCCcap(dbCCSeg* ccap, double v, uint model)
+void extMeasure::addCCcap(dbRSeg* rseg1, dbRSeg* rseg2, double v, uint model)
 {
   double coupling = _ccModify ? v * _ccFactor : v;
-  ccap->addCapacitance(coupling, model);
+  _extMain->addCouplingCap(rseg1, rseg2, coupling, model);
 }
 
 void extMeasure::addFringe(dbRSeg* rseg1,
@@ -2065,11 +2047,11 @@ void extMeasure::calcDiagRC(int rsegId1,
     rseg2 = dbRSeg::getRSeg(_block, rsegId2);
   }
 
-  dbCCSeg* ccCap = makeCcap(rseg1, rseg2, capTable[_minModelIndex]);
+  const bool ccCap = makeCcap(rseg1, rseg2, capTable[_minModelIndex]);
 
   for (uint model = 0; model < modelCnt; model++) {
-    if (ccCap != nullptr) {
-      addCCcap(ccCap, capTable[model], model);
+    if (ccCap) {
+      addCCcap(rseg1, rseg2, capTable[model], model);
     } else {
       addFringe(nullptr, rseg2, capTable[model], model);
     }
@@ -2087,12 +2069,12 @@ void extMeasure::createCap(int rsegId1, uint rsegId2, double* capTable)
     rseg2 = dbRSeg::getRSeg(_block, rsegId2);
   }
 
-  dbCCSeg* ccCap = makeCcap(rseg1, rseg2, capTable[_minModelIndex]);
+  const bool ccCap = makeCcap(rseg1, rseg2, capTable[_minModelIndex]);
 
   uint modelCnt = _metRCTable.getCnt();
   for (uint model = 0; model < modelCnt; model++) {
-    if (ccCap != nullptr) {
-      addCCcap(ccCap, capTable[model], model);
+    if (ccCap) {
+      addCCcap(rseg1, rseg2, capTable[model], model);
     } else {
       _rc[model]->_diag += capTable[model];
       addFringe(nullptr, rseg2, capTable[model], model);
@@ -2284,18 +2266,14 @@ void extMeasure::calcRC(dbRSeg* rseg1, dbRSeg* rseg2, uint totLenCovered)
         _extMain->updateRes(rseg2, res, model);
       }
 
-      dbCCSeg* ccap = nullptr;
+      bool ccap = false;
       bool includeCoupling = true;
       if ((rseg1 != nullptr) && (rseg2 != nullptr)) {  // signal nets
 
         _totCCcnt++;
 
         if (_rc[_minModelIndex]->_coupling >= _extMain->_coupleThreshold) {
-          ccap = dbCCSeg::create(
-              dbCapNode::getCapNode(_block, rseg1->getTargetNode()),
-              dbCapNode::getCapNode(_block, rseg2->getTargetNode()),
-              true);
-
+          ccap = true;
           includeCoupling = false;
           _totBigCCcnt++;
         } else {
@@ -2303,10 +2281,10 @@ void extMeasure::calcRC(dbRSeg* rseg1, dbRSeg* rseg2, uint totLenCovered)
         }
       }
       extDistRC* finalRC = _rc[model];
-      if (ccap != nullptr) {
+      if (ccap) {
         double coupling
             = _ccModify ? finalRC->_coupling * _ccFactor : finalRC->_coupling;
-        ccap->addCapacitance(coupling, model);
+        _extMain->addCouplingCap(rseg1, rseg2, coupling, model);
       }
 
       double frCap = _extMain->calcFringe(finalRC, deltaFr, includeCoupling);
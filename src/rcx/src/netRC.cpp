@@ -65,6 +65,7 @@ using odb::dbWire;
 using odb::dbWirePath;
 using odb::dbWirePathItr;
 using odb::dbWirePathShape;
+using odb::dbWireShapeItr;
 using odb::MAX_INT;
 using odb::Point;
 using odb::Rect;
@@ -1015,6 +1016,108 @@ void extMain::removeExt(std::vector<dbNet*>& nets)
   }
 }
 
+// Collects the signal nets to be re-extracted after an ECO and marks them:
+// the nets whose wire changed or that were never extracted, the nets they
+// had coupling caps to and the nets with wires within the coupling distance
+// of their new wires.
+void extMain::getIncrementalNets(std::vector<dbNet*>& nets)
+{
+  // Marks left by other tools would be taken as nets to re-extract.
+  for (dbNet* net : _block->getNets()) {
+    net->setMark(false);
+  }
+
+  std::vector<dbNet*> changedNets;
+  for (dbNet* net : _block->getNets()) {
+    if (net->getSigType().isSupply()) {
+      continue;
+    }
+    if (net->isWireAltered()
+        || (net->getWire() != nullptr && net->getRSegs().empty())) {
+      changedNets.push_back(net);
+    }
+  }
+  if (changedNets.empty()) {
+    return;
+  }
+
+  std::vector<dbNet*> haloNets;
+  _block->getCcHaloNets(changedNets, haloNets);
+
+  for (dbNet* net : changedNets) {
+    net->setMark(true);
+  }
+  for (dbNet* net : haloNets) {
+    net->setMark(true);
+  }
+
+  if (_couplingFlag > 1) {
+    int maxPitch = 0;
+    for (dbTechLayer* layer : _tech->getLayers()) {
+      if (layer->getRoutingLevel() > 0) {
+        maxPitch = std::max(maxPitch, layer->getPitch());
+      }
+    }
+    // Over/under context is on any layer, so the layers are not compared.
+    const int halo = (_couplingFlag + 1) * maxPitch;
+    const int binSize = std::max(16 * halo, 1);
+    std::map<std::pair<int, int>, std::vector<Rect>> bins;
+
+    dbWireShapeItr shapes;
+    dbShape s;
+    for (dbNet* net : changedNets) {
+      dbWire* wire = net->getWire();
+      if (wire == nullptr) {
+        continue;
+      }
+      for (shapes.begin(wire); shapes.next(s);) {
+        Rect r;
+        s.getBox().bloat(halo, r);
+        for (int x = r.xMin() / binSize; x <= r.xMax() / binSize; x++) {
+          for (int y = r.yMin() / binSize; y <= r.yMax() / binSize; y++) {
+            bins[{x, y}].push_back(r);
+          }
+        }
+      }
+    }
+
+    for (dbNet* net : _block->getNets()) {
+      dbWire* wire = net->getWire();
+      if (net->isMarked() || net->getSigType().isSupply()
+          || wire == nullptr) {
+        continue;
+      }
+      for (shapes.begin(wire); shapes.next(s) && !net->isMarked();) {
+        const Rect r = s.getBox();
+        for (int x = r.xMin() / binSize; x <= r.xMax() / binSize; x++) {
+          for (int y = r.yMin() / binSize; y <= r.yMax() / binSize; y++) {
+            auto it = bins.find({x, y});
+            if (it == bins.end() || net->isMarked()) {
+              continue;
+            }
+            for (const Rect& box : it->second) {
+              if (box.intersects(r)) {
+                net->setMark(true);
+                haloNets.push_back(net);
+                break;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  nets = changedNets;
+  nets.insert(nets.end(), haloNets.begin(), haloNets.end());
+  logger_->info(RCX,
+                10,
+                "Incremental extraction of {} modified nets and {} "
+                "neighboring nets.",
+                changedNets.size(),
+                haloNets.size());
+}
+
 void extCompute(CoupleOptions& inputTable, void* extModel);
 void extCompute1(CoupleOptions& inputTable, void* extModel);
 
@@ -1655,7 +1758,12 @@ bool extMain::setCorners(const char* rulesFileName)
   assert(_cornerCnt == _extDbCnt + scaleCornerCnt);
 #endif
 
-  _block->setCornerCount(_cornerCnt, _extDbCnt, nullptr);
+  // Setting the corners clears the parasitics, which an incremental
+  // extraction keeps when the corners are unchanged.
+  if (!_incremental || _block->getCornerCount() != (int) _cornerCnt
+      || _block->getExtDbCount() != (int) _extDbCnt) {
+    _block->setCornerCount(_cornerCnt, _extDbCnt, nullptr);
+  }
   return true;
 }
 
@@ -1708,6 +1816,53 @@ void extMain::getPrevControl()
   _usingMetalPlanes = _prevControl->_usingMetalPlanes;
 }
 
+void extMain::initCouplingMeasure(extMeasure* m)
+{
+  m->_extMain = this;
+  m->_block = _block;
+  m->_diagFlow = _diagFlow;
+
+  m->_resFactor = _resFactor;
+  m->_resModify = _resModify;
+  m->_ccFactor = _ccFactor;
+  m->_ccModify = _ccModify;
+  m->_gndcFactor = _gndcFactor;
+  m->_gndcModify = _gndcModify;
+
+  m->_dgContextArray = _dgContextArray;
+  m->_dgContextDepth = &_dgContextDepth;
+  m->_dgContextPlanes = &_dgContextPlanes;
+  m->_dgContextTracks = &_dgContextTracks;
+  m->_dgContextBaseLvl = &_dgContextBaseLvl;
+  m->_dgContextLowLvl = &_dgContextLowLvl;
+  m->_dgContextHiLvl = &_dgContextHiLvl;
+  m->_dgContextBaseTrack = _dgContextBaseTrack;
+  m->_dgContextLowTrack = _dgContextLowTrack;
+  m->_dgContextHiTrack = _dgContextHiTrack;
+  m->_dgContextTrackBase = _dgContextTrackBase;
+  m->_dgContextCnt = 0;
+
+  m->_ccContextArray = _ccContextArray;
+
+  m->_pixelTable = _geomSeq;
+  m->_minModelIndex = 0;  // couplimg threshold will be appled to this cap
+  m->_maxModelIndex = 0;
+  m->_currentModel = _currentModel;
+  m->_diagModel = _currentModel[0].getDiagModel();
+  for (uint ii = 0; ii < _modelMap.getCnt(); ii++) {
+    uint jj = _modelMap.get(ii);
+    m->_metRCTable.add(_currentModel->getMetRCTable(jj));
+  }
+  const uint techLayerCnt = getExtLayerCnt(_tech) + 1;
+  const uint modelLayerCnt = _currentModel->getLayerCnt();
+  m->_layerCnt = techLayerCnt < modelLayerCnt ? techLayerCnt : modelLayerCnt;
+  if (techLayerCnt == 5 && modelLayerCnt == 8) {
+    m->_layerCnt = modelLayerCnt;
+  }
+  m->getMinWidth(_tech);
+  m->allocOUpool();
+}
+
 void extMain::makeBlockRCsegs(const char* netNames,
                               uint cc_up,
                               uint ccFlag,
@@ -1755,7 +1910,25 @@ void extMain::makeBlockRCsegs(const char* netNames,
   }
   _foreign = false;  // extract after read_spef
 
-  _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  if (_incremental) {
+    getIncrementalNets(inets);
+    if (inets.empty()) {
+      logger_->info(
+          RCX, 11, "No net was modified since the last extraction.");
+      _modelTable->resetCnt(0);
+      return;
+    }
+    _allNet = false;
+    removeExt(inets);
+    if (!_tiledCoupling) {
+      logger_->info(RCX,
+                    13,
+                    "Coupling of the whole die is recomputed; use -tiled to "
+                    "limit it to the windows of the modified nets.");
+    }
+  } else {
+    _allNet = !((dbBlock*) _block)->findSomeNet(netNames, inets);
+  }
 
   if (_ccContextDepth) {
     initContextArray();
@@ -1834,52 +2007,10 @@ void extMain::makeBlockRCsegs(const char* netNames,
                   _coupleThreshold,
                   _coupleThreshold);
 
-    m._extMain = this;
-    m._block = _block;
-    m._diagFlow = _diagFlow;
-
-    m._resFactor = _resFactor;
-    m._resModify = _resModify;
-    m._ccFactor = _ccFactor;
-    m._ccModify = _ccModify;
-    m._gndcFactor = _gndcFactor;
-    m._gndcModify = _gndcModify;
-
-    m._dgContextArray = _dgContextArray;
-    m._dgContextDepth = &_dgContextDepth;
-    m._dgContextPlanes = &_dgContextPlanes;
-    m._dgContextTracks = &_dgContextTracks;
-    m._dgContextBaseLvl = &_dgContextBaseLvl;
-    m._dgContextLowLvl = &_dgContextLowLvl;
-    m._dgContextHiLvl = &_dgContextHiLvl;
-    m._dgContextBaseTrack = _dgContextBaseTrack;
-    m._dgContextLowTrack = _dgContextLowTrack;
-    m._dgContextHiTrack = _dgContextHiTrack;
-    m._dgContextTrackBase = _dgContextTrackBase;
+    initCouplingMeasure(&m);
     if (ttttPrintDgContext) {
       m._dgContextFile = fopen("dgCtxtFile", "w");
     }
-    m._dgContextCnt = 0;
-
-    m._ccContextArray = _ccContextArray;
-
-    m._pixelTable = _geomSeq;
-    m._minModelIndex = 0;  // couplimg threshold will be appled to this cap
-    m._maxModelIndex = 0;
-    m._currentModel = _currentModel;
-    m._diagModel = _currentModel[0].getDiagModel();
-    for (uint ii = 0; ii < _modelMap.getCnt(); ii++) {
-      uint jj = _modelMap.get(ii);
-      m._metRCTable.add(_currentModel->getMetRCTable(jj));
-    }
-    const uint techLayerCnt = getExtLayerCnt(_tech) + 1;
-    const uint modelLayerCnt = _currentModel->getLayerCnt();
-    m._layerCnt = techLayerCnt < modelLayerCnt ? techLayerCnt : modelLayerCnt;
-    if (techLayerCnt == 5 && modelLayerCnt == 8) {
-      m._layerCnt = modelLayerCnt;
-    }
-    m.getMinWidth(_tech);
-    m.allocOUpool();
 
     m._debugFP = nullptr;
     m._netId = 0;
@@ -1893,7 +2024,11 @@ void extMain::makeBlockRCsegs(const char* netNames,
 
     Rect maxRect = _block->getDieArea();
 
-    couplingFlow(maxRect, _couplingFlag, &m, extCompute1);
+    if (_tiledCoupling) {
+      couplingFlowTiled(maxRect, _couplingFlag);
+    } else {
+      couplingFlow(maxRect, _couplingFlag, &m, extCompute1);
+    }
 
     if (m._debugFP != nullptr) {
       fclose(m._debugFP);
@@ -1940,6 +2075,12 @@ void extMain::makeBlockRCsegs(const char* netNames,
       net->setMark(false);
       net->setWireAltered(false);
     }
+    if (_incremental) {
+      // Neighbours of the modified nets were marked as well.
+      for (dbNet* net : _block->getNets()) {
+        net->setMark(false);
+      }
+    }
   }
 
   _modelTable->resetCnt(0);
@@ -2122,6 +2263,7 @@ void extMain::writeSPEF(char* filename,
                         const char* capUnit,
                         const char* resUnit,
                         bool gzFlag,
+                        bool zstdFlag,
                         bool stopAfterMap,
                         bool wClock,
                         bool wConn,
@@ -2135,7 +2277,8 @@ void extMain::writeSPEF(char* filename,
                         int corner,
                         const char* corner_name,
                         const char* spef_version,
-                        bool parallel)
+                        bool parallel,
+                        int threadCnt)
 {
   if (_block == nullptr) {
     logger_->info(
@@ -2168,7 +2311,10 @@ void extMain::writeSPEF(char* filename,
 
   if (gzFlag) {
     _spef->setGzipFlag(gzFlag);
+  } else if (zstdFlag) {
+    _spef->setZstdFlag(zstdFlag);
   }
+  _spef->setThreadCnt(threadCnt);
 
   _spef->setDesign((char*) _block->getName().c_str());
 
@@ -516,8 +516,19 @@ class Ath__grid
                    CoupleAndCompute coupleAndCompute,
                    void* compPtr,
                    int* limitArray);
+  uint couplingCapsInWindow(int loXY,
+                            int hiXY,
+                            uint couplingDist,
+                            CoupleAndCompute coupleAndCompute,
+                            void* compPtr);
   int dealloc(int hiXY);
   void dealloc();
+
+ private:
+  uint trackCouplingCaps(uint trackNum,
+                         uint couplingDist,
+                         CoupleAndCompute coupleAndCompute,
+                         void* compPtr);
 };
 
 class Ath__gridTable
@@ -767,6 +778,12 @@ class Ath__gridTable
                             CoupleAndCompute coupleAndCompute,
                             void* compPtr,
                             int* startXY = nullptr);
+  uint couplingCapsInWindow(uint dir,
+                            int loXY,
+                            int hiXY,
+                            uint couplingDist,
+                            CoupleAndCompute coupleAndCompute,
+                            void* compPtr);
   int dealloc(uint dir, int hiXY);
   void dealloc();
 
@@ -0,0 +1,158 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+// Timing driver for extract_parasitics and read_spef on larger designs, run
+// by hand rather than by ctest.  It reads the LEF and DEF with odb, applies
+// the set_layer_rc lines of an .rc file the way rsz does for the db layers,
+// extracts with the given threads and window size, writes the SPEF and
+// optionally reads it back into a fresh copy of the design.
+//
+// usage: rcxExtractBench tech.lef cells.lef design.def layers.rc model.rules
+//                        threads tiled tile_size out.spef [read]
+//
+// make_tiled_def.py builds an n x n array of gcd.def to run it on.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "rcx/ext.h"
+#include "utl/Logger.h"
+
+namespace {
+
+double seconds()
+{
+  return std::chrono::duration<double>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// set_layer_rc with the liberty units of the rcx tests (kohm, pF, um).
+void applyLayerRC(odb::dbTech* tech, const char* rc_file)
+{
+  const std::regex layer_rc(
+      R"(set_layer_rc -layer (\S+) -capacitance (\S+) -resistance (\S+))");
+  const std::regex via_rc(R"(set_layer_rc -via (\S+) -resistance (\S+))");
+  std::ifstream in(rc_file);
+  std::string line;
+  std::smatch match;
+  while (std::getline(in, line)) {
+    if (std::regex_search(line, match, layer_rc)) {
+      odb::dbTechLayer* layer = tech->findLayer(match[1].str().c_str());
+      const double cap = std::stod(match[2]) * 1e-6;  // F/m
+      const double res = std::stod(match[3]) * 1e9;   // ohm/m
+      const double width
+          = layer->getWidth() / double(tech->getDbUnitsPerMicron());
+      layer->setEdgeCapacitance(0);
+      layer->setCapacitance(cap * 1e6 / width);
+      layer->setResistance(width * 1e-6 * res);
+    } else if (std::regex_search(line, match, via_rc)) {
+      odb::dbTechLayer* layer = tech->findLayer(match[1].str().c_str());
+      layer->setResistance(std::stod(match[2]) * 1e3);
+    }
+  }
+}
+
+odb::dbDatabase* loadDesign(utl::Logger* logger, char* argv[])
+{
+  odb::dbDatabase* db = odb::dbDatabase::create();
+  odb::lefin lef_reader(db, logger, false);
+  odb::dbLib* tech_lib = lef_reader.createTechAndLib("tech", "tech", argv[1]);
+  odb::dbTech* tech = tech_lib->getTech();
+  odb::dbLib* cell_lib = lef_reader.createLib(tech, "cells", argv[2]);
+  std::vector<odb::dbLib*> libs{tech_lib, cell_lib};
+  odb::defin def_reader(db, logger);
+  def_reader.createChip(libs, argv[3], tech);
+  applyLayerRC(tech, argv[4]);
+  return db;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[])
+{
+  if (argc < 10) {
+    fprintf(stderr,
+            "usage: %s tech.lef cells.lef design.def layers.rc model.rules "
+            "threads tiled tile_size out.spef [read]\n",
+            argv[0]);
+    return 1;
+  }
+
+  utl::Logger logger;
+  odb::dbDatabase* db = loadDesign(&logger, argv);
+
+  const int threads = atoi(argv[6]);
+  rcx::Ext ext;
+  ext.init(db, &logger, "bench");
+  ext.define_process_corner(0, "X");
+
+  rcx::Ext::ExtractOptions extract_opts;
+  extract_opts.ext_model_file = argv[5];
+  extract_opts.max_res = 0;
+  extract_opts.coupling_threshold = 0.1;
+  extract_opts.tiled = atoi(argv[7]) != 0;
+  extract_opts.tile_size = atoi(argv[8]);
+  extract_opts.threads = threads;
+  const double extract_start = seconds();
+  ext.extract(extract_opts);
+  const double extract_time = seconds() - extract_start;
+
+  rcx::Ext::SpefOptions spef_opts;
+  spef_opts.file = argv[9];
+  spef_opts.nets = "";
+  spef_opts.threads = threads;
+  spef_opts.parallel = threads > 1;
+  const double write_start = seconds();
+  ext.write_spef(spef_opts);
+  const double write_time = seconds() - write_start;
+  printf("extract %.3fs write_spef %.3fs\n", extract_time, write_time);
+
+  if (argc > 10) {
+    rcx::Ext reader;
+    reader.init(loadDesign(&logger, argv), &logger, "bench");
+    rcx::Ext::ReadSpefOpts read_opts;
+    read_opts.file = argv[9];
+    const double read_start = seconds();
+    reader.read_spef(read_opts);
+    printf("read_spef %.3fs\n", seconds() - read_start);
+  }
+  return 0;
+}
@@ -0,0 +1,30 @@
+source helpers.tcl
+
+set test_nets ""
+
+read_lef sky130hs/sky130hs.tlef 
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1
+# No wire changed, so the parasitics are kept as they are
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1 -incremental
+
+set spef_file [make_result_file gcd_incremental.spef] 
+write_spef $spef_file -nets $test_nets
+
+read_spef $spef_file
+
+if { [diff_files gcd.spefok $spef_file "^\\*(DATE|VERSION)"] } {
+  exit 1
+}
+puts "pass"
+exit
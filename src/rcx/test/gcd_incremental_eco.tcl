@@ -0,0 +1,43 @@
+source helpers.tcl
+
+set test_nets ""
+
+read_lef sky130hs/sky130hs.tlef 
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+set_thread_count 2
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1 -tiled
+
+# ECO: unroute _003_ and re-extract it and its neighbors
+set net [[ord::get_db_block] findNet _003_]
+set wire [$net getWire]
+$wire detach
+if { ![$net isWireAltered] } {
+  puts "detach did not mark _003_"
+  exit 1
+}
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1 -tiled -incremental
+
+# ECO: route it again; the result must match the full extraction
+$wire attach $net
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1 -tiled -incremental
+
+set spef_file [make_result_file gcd_incremental_eco.spef] 
+write_spef $spef_file -nets $test_nets
+
+# gcd.spefok is the SPEF of a full extraction
+if { [diff_files gcd.spefok $spef_file "^\\*(DATE|VERSION)"] } {
+  exit 1
+}
+puts "pass"
+exit
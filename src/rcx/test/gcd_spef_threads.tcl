@@ -0,0 +1,33 @@
+source helpers.tcl
+
+set test_nets ""
+
+read_lef sky130hs/sky130hs.tlef 
+read_lef sky130hs/sky130hs_std_cell.lef
+read_liberty sky130hs/sky130hs_tt.lib
+
+read_def gcd.def
+
+# Load via resistance info
+source sky130hs/sky130hs.rc
+
+define_process_corner -ext_model_index 0 X
+extract_parasitics -ext_model_file ext_pattern.rules \
+      -max_res 0 -coupling_threshold 0.1
+
+set serial_file [make_result_file gcd_spef_threads1.spef] 
+write_spef $serial_file -nets $test_nets
+
+# The nets are formatted in chunks on 4 threads
+set_thread_count 4
+set spef_file [make_result_file gcd_spef_threads.spef] 
+write_spef $spef_file -nets $test_nets
+
+if { [diff_files $serial_file $spef_file "^\\*(DATE|VERSION)"] } {
+  exit 1
+}
+if { [diff_files gcd.spefok $spef_file "^\\*(DATE|VERSION)"] } {
+  exit 1
+}
+puts "pass"
+exit
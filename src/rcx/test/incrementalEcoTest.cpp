@@ -0,0 +1,259 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2026, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#define BOOST_TEST_MODULE incrementalEco
+
+#ifdef HAS_BOOST_UNIT_TEST_LIBRARY
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+#else
+#include <boost/test/included/unit_test.hpp>
+#endif
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "odb/db.h"
+#include "odb/dbShape.h"
+#include "odb/dbWireCodec.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "rcx/ext.h"
+#include "utl/Logger.h"
+
+// Run from src/rcx/test.
+namespace rcx {
+
+struct GcdFixture
+{
+  GcdFixture()
+  {
+    db = odb::dbDatabase::create();
+    odb::lefin lef_reader(db, &logger, false);
+    odb::dbLib* tech_lib = lef_reader.createTechAndLib(
+        "sky130hs", "sky130hs", "sky130hs/sky130hs.tlef");
+    odb::dbLib* cell_lib = lef_reader.createLib(
+        tech_lib->getTech(), "cells", "sky130hs/sky130hs_std_cell.lef");
+    std::vector<odb::dbLib*> libs{tech_lib, cell_lib};
+    odb::defin def_reader(db, &logger);
+    def_reader.createChip(libs, "gcd.def", tech_lib->getTech());
+    block = db->getChip()->getBlock();
+
+    ext.init(db, &logger, "test");
+    ext.define_process_corner(0, "X");
+    extract(false);
+    full_spef = writeSpef("gcd_full.spef");
+  }
+
+  ~GcdFixture() { odb::dbDatabase::destroy(db); }
+
+  void extract(bool incremental)
+  {
+    Ext::ExtractOptions opts;
+    opts.ext_model_file = "ext_pattern.rules";
+    opts.max_res = 0;
+    opts.coupling_threshold = 0.1;
+    opts.tiled = true;
+    opts.threads = 2;
+    opts.incremental = incremental;
+    ext.extract(opts);
+  }
+
+  std::string writeSpef(const char* name)
+  {
+    const std::string file
+        = (std::filesystem::temp_directory_path() / name).string();
+    Ext::SpefOptions opts;
+    opts.file = file.c_str();
+    opts.nets = "";
+    ext.write_spef(opts);
+    return file;
+  }
+
+  utl::Logger logger;
+  odb::dbDatabase* db;
+  odb::dbBlock* block;
+  Ext ext;
+  std::string full_spef;
+};
+
+// Lines of a SPEF file without its *DATE line.
+static std::vector<std::string> spefLines(const std::string& file)
+{
+  std::vector<std::string> lines;
+  std::ifstream in(file);
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.rfind("*DATE", 0) != 0) {
+      lines.push_back(line);
+    }
+  }
+  return lines;
+}
+
+static std::vector<std::pair<odb::dbTechLayer*, odb::Rect>> wireShapes(
+    odb::dbWire* wire)
+{
+  std::vector<std::pair<odb::dbTechLayer*, odb::Rect>> shapes;
+  odb::dbWireShapeItr itr;
+  odb::dbShape shape;
+  for (itr.begin(wire); itr.next(shape);) {
+    shapes.emplace_back(shape.getTechLayer(), shape.getBox());
+  }
+  return shapes;
+}
+
+// Writes the same route into the wire again with dbWireEncoder, as a router
+// does when it replaces a route.
+static void reencode(odb::dbWire* wire)
+{
+  odb::dbWireDecoder decoder;
+  odb::dbWireEncoder encoder;
+  decoder.begin(wire);
+  encoder.begin(wire);
+  int junction = -1;
+  for (auto op = decoder.next(); op != odb::dbWireDecoder::END_DECODE;
+       op = decoder.next()) {
+    int x, y, ext;
+    switch (op) {
+      case odb::dbWireDecoder::PATH:
+        encoder.newPath(decoder.getLayer(), decoder.getWireType());
+        break;
+      case odb::dbWireDecoder::JUNCTION:
+        // The junction point follows as the first point of the path.
+        junction = decoder.getJunctionValue();
+        break;
+      case odb::dbWireDecoder::SHORT:
+        encoder.newPathShort(decoder.getJunctionValue(),
+                             decoder.getLayer(),
+                             decoder.getWireType());
+        break;
+      case odb::dbWireDecoder::VWIRE:
+        encoder.newPathVirtualWire(decoder.getJunctionValue(),
+                                   decoder.getLayer(),
+                                   decoder.getWireType());
+        break;
+      case odb::dbWireDecoder::POINT:
+        if (junction >= 0) {
+          encoder.newPath(junction, decoder.getWireType());
+          junction = -1;
+        } else {
+          decoder.getPoint(x, y);
+          encoder.addPoint(x, y);
+        }
+        break;
+      case odb::dbWireDecoder::POINT_EXT:
+        decoder.getPoint(x, y, ext);
+        if (junction >= 0) {
+          encoder.newPathExt(junction, ext, decoder.getWireType());
+          junction = -1;
+        } else {
+          encoder.addPoint(x, y, ext);
+        }
+        break;
+      case odb::dbWireDecoder::VIA:
+        encoder.addVia(decoder.getVia());
+        break;
+      case odb::dbWireDecoder::TECH_VIA:
+        encoder.addTechVia(decoder.getTechVia());
+        break;
+      case odb::dbWireDecoder::RECT: {
+        int x1, y1, x2, y2;
+        decoder.getRect(x1, y1, x2, y2);
+        encoder.addRect(x1, y1, x2, y2);
+        break;
+      }
+      case odb::dbWireDecoder::ITERM:
+        encoder.addITerm(decoder.getITerm());
+        break;
+      case odb::dbWireDecoder::BTERM:
+        encoder.addBTerm(decoder.getBTerm());
+        break;
+      default:
+        BOOST_FAIL("unexpected wire opcode " << op);
+    }
+  }
+  encoder.end();
+}
+
+BOOST_FIXTURE_TEST_SUITE(incremental_eco, GcdFixture)
+
+BOOST_AUTO_TEST_CASE(unchanged)
+{
+  extract(true);
+  const std::string spef = writeSpef("gcd_unchanged.spef");
+  BOOST_TEST(spefLines(spef) == spefLines(full_spef));
+}
+
+BOOST_AUTO_TEST_CASE(reencoded_wire)
+{
+  odb::dbNet* net = block->findNet("_003_");
+  odb::dbWire* wire = net->getWire();
+  const auto shapes = wireShapes(wire);
+  BOOST_TEST(!net->isWireAltered());
+
+  reencode(wire);
+  BOOST_TEST((wireShapes(wire) == shapes));
+  BOOST_TEST(net->isWireAltered());
+
+  extract(true);
+  BOOST_TEST(!net->isWireAltered());
+  const std::string spef = writeSpef("gcd_reencoded.spef");
+  BOOST_TEST(spefLines(spef) == spefLines(full_spef));
+}
+
+BOOST_AUTO_TEST_CASE(detach_attach)
+{
+  odb::dbNet* net = block->findNet("_003_");
+  odb::dbWire* wire = net->getWire();
+
+  wire->detach();
+  BOOST_TEST(net->isWireAltered());
+  extract(true);
+  const std::string unrouted = writeSpef("gcd_unrouted.spef");
+  BOOST_TEST(spefLines(unrouted) != spefLines(full_spef));
+
+  // The unrouted net lost its RC segments, so it is re-extracted without
+  // being marked.
+  wire->attach(net);
+  BOOST_TEST((net->isWireAltered() || net->getRSegs().empty()));
+  extract(true);
+  const std::string spef = writeSpef("gcd_attached.spef");
+  BOOST_TEST(spefLines(spef) == spefLines(full_spef));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}  // namespace rcx
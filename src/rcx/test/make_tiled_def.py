@@ -0,0 +1,124 @@
+###############################################################################
+##
+## BSD 3-Clause License
+##
+## Copyright (c) 2026, The Regents of the University of California
+## All rights reserved.
+##
+## Redistribution and use in source and binary forms, with or without
+## modification, are permitted provided that the following conditions are met:
+##
+## * Redistributions of source code must retain the above copyright notice, this
+##   list of conditions and the following disclaimer.
+##
+## * Redistributions in binary form must reproduce the above copyright notice,
+##   this list of conditions and the following disclaimer in the documentation
+##   and#or other materials provided with the distribution.
+##
+## * Neither the name of the copyright holder nor the names of its
+##   contributors may be used to endorse or promote products derived from
+##   this software without specific prior written permission.
+##
+## THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+## AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+## IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+## ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+## LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+## CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+## SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+## INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+## CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+## ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+## POSSIBILITY OF SUCH DAMAGE.
+##
+
+# Builds an n x n array of shifted, renamed copies of a routed DEF, a larger
+# design for rcxExtractBench.  ROWS, PINS and SPECIALNETS are dropped; the
+# extraction only needs the components and the routed signal nets.
+#
+# usage: make_tiled_def.py gcd.def n out.def
+
+import re
+import sys
+
+# Multiples of the sky130hs site width and row height, larger than gcd.
+STEP_X = 626 * 480
+STEP_Y = 91 * 3330
+
+point = re.compile(r"\(\s*(\S+)\s+(\S+)\s*\)")
+
+
+def statements(text, section):
+    begin = text.index("\n%s " % section) + 1
+    end = text.index("END %s" % section, begin)
+    body = text[begin:end]
+    return [s.strip() for s in body[body.index(";") + 1 :].split(";") if s.strip()]
+
+
+def rename(statement, prefix):
+    return re.sub(r"^- (\S+)", lambda m: "- " + prefix + m.group(1), statement)
+
+
+def rename_net(statement, prefix):
+    # The rcx SPEF reader does not undo the writer's escapes of '.' and '$',
+    # so they are left out of the net names to read the SPEF back.
+    return re.sub(
+        r"^- (\S+)",
+        lambda m: "- " + prefix + re.sub(r"[.$]", "_", m.group(1)),
+        statement,
+    )
+
+
+def shift(match, dx, dy, prefix):
+    x, y = match.group(1), match.group(2)
+    if x == "PIN":
+        return ""
+    if not re.match(r"^(-?\d+|\*)$", x):
+        # ( inst pin )
+        return "( %s%s %s )" % (prefix, x, y)
+    x = x if x == "*" else str(int(x) + dx)
+    y = y if y == "*" else str(int(y) + dy)
+    return "( %s %s )" % (x, y)
+
+
+def main():
+    src, n, out = sys.argv[1], int(sys.argv[2]), sys.argv[3]
+    text = open(src).read()
+    components = statements(text, "COMPONENTS")
+    nets = statements(text, "NETS")
+    vias = text[text.index("\nVIAS ") + 1 : text.index("END VIAS") + 8]
+    tracks = re.findall(r"^TRACKS .*;$", text, re.M)
+    copies = [
+        ("t%d_%d_" % (i, j), i * STEP_X, j * STEP_Y)
+        for i in range(n)
+        for j in range(n)
+    ]
+
+    with open(out, "w") as f:
+        f.write('VERSION 5.8 ;\nDIVIDERCHAR "/" ;\nBUSBITCHARS "[]" ;\n')
+        f.write("DESIGN tiled ;\nUNITS DISTANCE MICRONS 1000 ;\n")
+        f.write("DIEAREA ( 0 0 ) ( %d %d ) ;\n" % (n * STEP_X, n * STEP_Y))
+        for track in tracks:
+            f.write(re.sub(r"DO (\d+)", lambda m: "DO %d" % (int(m.group(1)) * n), track))
+            f.write("\n")
+        f.write(vias + "\n")
+        f.write("COMPONENTS %d ;\n" % (len(components) * len(copies)))
+        for prefix, dx, dy in copies:
+            for component in components:
+                component = rename(component, prefix)
+                component = point.sub(
+                    lambda m: "( %d %d )" % (int(m.group(1)) + dx, int(m.group(2)) + dy),
+                    component,
+                )
+                f.write(component + " ;\n")
+        f.write("END COMPONENTS\n")
+        f.write("NETS %d ;\n" % (len(nets) * len(copies)))
+        for prefix, dx, dy in copies:
+            for net in nets:
+                net = point.sub(lambda m: shift(m, dx, dy, prefix), rename_net(net, prefix))
+                f.write(net + " ;\n")
+        f.write("END NETS\nEND DESIGN\n")
+
+
+if __name__ == "__main__":
+    main()
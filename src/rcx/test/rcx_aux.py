@@ -17,7 +17,10 @@ def extract_parasitics(*, ext_model_file=None,
                        lef_res=False,
                        cc_model=10,
                        context_depth=5,
-                       no_merge_via_res=False
+                       no_merge_via_res=False,
+                       tiled=False,
+                       tile_size=1000,
+                       incremental=False
                        ):
     # NOTE: This is position dependent
     rcx.extract(ext_model_file,
@@ -28,11 +31,15 @@ def extract_parasitics(*, ext_model_file=None,
                 context_depth,
                 debug_net_id,
                 lef_res,
-                no_merge_via_res)
+                no_merge_via_res,
+                tiled,
+                tile_size,
+                incremental)
 
 
-def write_spef(*, filename="", nets="", net_id=0, coordinates=False):
-    rcx.write_spef(filename, nets, net_id, coordinates)
+def write_spef(*, filename="", nets="", net_id=0, coordinates=False,
+               gzip=False, zstd=False):
+    rcx.write_spef(filename, nets, net_id, coordinates, gzip, zstd)
 
 
 def bench_verilog(*, filename=""):
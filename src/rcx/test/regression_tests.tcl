@@ -10,4 +10,9 @@ record_tests {
 }
 record_pass_fail_tests {
   rcx_unit_test
+  gcd_tiled
+  gcd_tiled_windows
+  gcd_incremental
+  gcd_incremental_eco
+  gcd_spef_threads
 }
@@ -359,6 +359,11 @@ class Resizer : public StaState
   // resizeSlackPreamble must be called before the first findResizeSlacks.
   void resizeSlackPreamble();
   void findResizeSlacks();
+  // findResizeSlacks that only re-estimates the parasitics of moved_nets
+  // and of the nets touched by the previous pass. repair_design and the
+  // slack collection still visit the whole design. Falls back to
+  // findResizeSlacks without placement parasitics.
+  void findResizeSlacks(const vector<dbNet*>& moved_nets);
   // Return nets with worst slack.
   NetSeq& resizeWorstSlackNets();
   // Return net slack, if any (indicated by the bool).
@@ -366,6 +371,9 @@ class Resizer : public StaState
   // db flavor
   vector<dbNet*> resizeWorstSlackDbNets();
   std::optional<Slack> resizeNetSlack(const dbNet* db_net);
+  // Slacks of db_nets, in the same order, read from the per dbNet id
+  // array filled by the last findResizeSlacks.
+  vector<std::optional<Slack>> resizeNetSlacks(const vector<dbNet*>& db_nets);
 
   ////////////////////////////////////////////////////////////////
   // API for logic resynthesis
@@ -678,6 +686,8 @@ class Resizer : public StaState
   float max_wire_length_ = 0;
   float worst_slack_nets_percent_ = 10;
   Map<const Net*, Slack> net_slack_map_;
+  // Driver slacks of the last findResizeSlacks indexed by dbNet id.
+  vector<std::optional<Slack>> db_net_slacks_;
   NetSeq worst_slack_nets_;
 
   // Journal to roll back changes (OpenDB not up to the task).
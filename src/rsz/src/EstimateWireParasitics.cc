@@ -333,8 +333,29 @@ void Resizer::updateParasitics(bool save_guides)
       break;
     case ParasiticsSrc::global_routing: {
       incr_groute_->updateRoutes(save_guides);
+      // Rerouted nets, including ones moved off congestion, nets with moved
+      // pins and nets of resized instances.
+      const std::set<dbNet*>& dirty_nets
+          = global_router_->getParasiticsDirtyNets();
+      while (!dirty_nets.empty()) {
+        global_router_->estimateRC(*dirty_nets.begin());
+      }
+      // The remaining nets kept their route and pins, so their parasitics
+      // are kept unless they were deleted.
+      const Corner* corner = sta_->corners()->findCorner(0);
+      const ParasiticAnalysisPt* parasitic_ap
+          = corner->findParasiticAnalysisPt(max_);
       for (const Net* net : parasitics_invalid_) {
-        global_router_->estimateRC(db_network_->staToDb(net));
+        PinSet* drivers = network_->drivers(net);
+        if (drivers && !drivers->empty()) {
+          PinSet::Iterator drvr_iter(drivers);
+          const Pin* drvr_pin = drvr_iter.next();
+          if (parasitics_->findPiElmore(
+                  drvr_pin, RiseFall::rise(), parasitic_ap)
+              == nullptr) {
+            global_router_->estimateRC(db_network_->staToDb(net));
+          }
+        }
       }
       parasitics_invalid_.clear();
       break;
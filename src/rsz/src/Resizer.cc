@@ -1211,11 +1211,40 @@ void Resizer::findResizeSlacks()
   journalRestore(resize_count_, inserted_buffer_count_, cloned_gate_count_);
 }
 
+void Resizer::findResizeSlacks(const vector<dbNet*>& moved_nets)
+{
+  if (parasitics_src_ != ParasiticsSrc::placement) {
+    findResizeSlacks();
+    return;
+  }
+  // The nets of the buffers removed by the previous journalRestore are
+  // already invalid.
+  for (dbNet* db_net : moved_nets) {
+    parasiticsInvalid(db_net);
+  }
+  journalBegin();
+  updateParasitics();
+  int repaired_net_count, slew_violations, cap_violations;
+  int fanout_violations, length_violations;
+  repair_design_->repairDesign(max_wire_length_,
+                               0.0,
+                               0.0,
+                               false,
+                               repaired_net_count,
+                               slew_violations,
+                               cap_violations,
+                               fanout_violations,
+                               length_violations);
+  findResizeSlacks1();
+  journalRestore(resize_count_, inserted_buffer_count_, cloned_gate_count_);
+}
+
 void Resizer::findResizeSlacks1()
 {
   // Use driver pin slacks rather than Sta::netSlack to save visiting
   // the net pins and min'ing the slack.
   net_slack_map_.clear();
+  db_net_slacks_.clear();
   NetSeq nets;
   for (int i = level_drvr_vertices_.size() - 1; i >= 0; i--) {
     Vertex* drvr = level_drvr_vertices_[i];
@@ -1227,8 +1256,14 @@ void Resizer::findResizeSlacks1()
         && !drvr->isConstant()
         // Hands off special nets.
         && !db_network_->isSpecial(net) && !sta_->isClock(drvr_pin)) {
-      net_slack_map_[net] = sta_->vertexSlack(drvr, max_);
+      const Slack slack = sta_->vertexSlack(drvr, max_);
+      net_slack_map_[net] = slack;
       nets.emplace_back(net);
+      const size_t id = db_network_->staToDb(net)->getId();
+      if (id >= db_net_slacks_.size()) {
+        db_net_slacks_.resize(id + 1);
+      }
+      db_net_slacks_[id] = slack;
     }
   }
 
@@ -1273,6 +1308,22 @@ std::optional<Slack> Resizer::resizeNetSlack(const dbNet* db_net)
   return resizeNetSlack(net);
 }
 
+vector<std::optional<Slack>> Resizer::resizeNetSlacks(
+    const vector<dbNet*>& db_nets)
+{
+  vector<std::optional<Slack>> slacks;
+  slacks.reserve(db_nets.size());
+  for (const dbNet* db_net : db_nets) {
+    const size_t id = db_net->getId();
+    if (id < db_net_slacks_.size()) {
+      slacks.emplace_back(db_net_slacks_[id]);
+    } else {
+      slacks.emplace_back();
+    }
+  }
+  return slacks;
+}
+
 ////////////////////////////////////////////////////////////////
 
 // API for logic resynthesis
@@ -76,6 +76,7 @@ using sta::LibertyCell;
 using sta::Instance;
 using sta::Net;
 using sta::NetSeq;
+using sta::NetSet;
 using sta::Pin;
 using sta::PinSet;
 using sta::TmpPinSet;
@@ -190,6 +191,12 @@ tclListNetworkSet(Tcl_Obj *const source,
   $1 = tclListNetworkSet<PinSet, Pin>($input, SWIGTYPE_p_Pin, interp, network);
 }
 
+%typemap(in) NetSet* {
+  Resizer *resizer = getResizer();
+  dbNetwork *network = resizer->getDbNetwork();
+  $1 = tclListNetworkSet<NetSet, Net>($input, SWIGTYPE_p_Net, interp, network);
+}
+
 %typemap(out) PinSet {
   Tcl_Obj *list = Tcl_NewListObj(0, nullptr);
   PinSet::Iterator pin_iter($1);
@@ -639,6 +646,22 @@ find_resize_slacks()
   resizer->findResizeSlacks();
 }
 
+void
+find_resize_slacks_incremental(NetSet *nets)
+{
+  Resizer *resizer = getResizer();
+  dbNetwork *network = resizer->getDbNetwork();
+  std::vector<odb::dbNet*> db_nets;
+  if (nets) {
+    NetSet::Iterator net_iter(nets);
+    while (net_iter.hasNext()) {
+      db_nets.push_back(network->staToDb(net_iter.next()));
+    }
+    delete nets;
+  }
+  resizer->findResizeSlacks(db_nets);
+}
+
 NetSeq *
 resize_worst_slack_nets()
 {
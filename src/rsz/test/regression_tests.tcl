@@ -112,3 +112,8 @@ record_tests {
   #rsz_man_tcl_check
   #rsz_readme_msgs_check
 }
+
+record_pass_fail_tests {
+  resize_slack4
+  repair_setup7
+}
@@ -0,0 +1,37 @@
+# repair_timing -setup with global route parasitics updated incrementally
+# must end with the same parasitics as estimating them from scratch
+source "helpers.tcl"
+read_liberty Nangate45/Nangate45_typ.lib
+read_lef Nangate45/Nangate45.lef
+read_def repair_setup1.def
+initialize_floorplan -die_area "0 0 40 1200" \
+  -core_area "0 0 40 1200" \
+  -site FreePDK45_38x28_10R_NP_162NW_34O
+
+source Nangate45/Nangate45.vars
+source Nangate45/Nangate45.rc
+source $tracks_file
+
+create_clock -period 0.3 clk
+set_propagated_clock clk
+
+detailed_placement
+
+source Nangate45/Nangate45.rc
+set_wire_rc -resistance 0.0001 -capacitance 0.00001
+set_routing_layers -signal $global_routing_layers
+global_route
+estimate_parasitics -global_routing
+
+repair_timing -setup
+set incr_slack [worst_slack -max]
+
+# fresh parasitics from the same routes
+estimate_parasitics -global_routing
+set full_slack [worst_slack -max]
+if { $incr_slack != $full_slack } {
+  puts "incremental slack $incr_slack differs from full slack $full_slack"
+  exit 1
+}
+puts "pass"
+exit